@@ -4,11 +4,17 @@
 #include "util/auto_release.hpp"
 #include "util/config.hpp"
 #include "util/convertible_to_pointer.hpp"
+#include "util/deferred_action.hpp"
 #include "util/flags.hpp"
 #include "util/defer.hpp"
 #include "util/method_macros.hpp"
+#include "util/object_pool.hpp"
 #include "util/spans.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <expected>
 #include <future>
 #include <math/color.hpp>
 #include <slcross.hpp>
@@ -33,6 +39,14 @@ namespace stylizer {
 	};
 
 	stylizer::signal<void(error_severity, std::string_view message, size_t error_tag)>& get_error_handler();
+
+	// Reports less severe than this are dropped before their message is even built
+	inline std::atomic<error_severity> error_threshold = error_severity::Verbose;
+
+	// True if a report of the given severity would reach a handler (check this before building an expensive message)
+	inline bool error_reporting_enabled(error_severity severity) {
+		return severity >= error_threshold.load(std::memory_order_relaxed) && !get_error_handler().calls.empty();
+	}
 }
 namespace stylizer::api {
 
@@ -57,10 +71,56 @@ namespace stylizer::api {
 		using severity = error_severity;
 	};
 
+	// Returned by the try_ variants of fallible operations (which never throw)
+	enum class error_code {
+		None,
+		NoAdapter,
+		AdapterQueryFailed,
+		MissingFeature,
+		DeviceCreationFailed,
+		DeviceLost,
+		MapFailed,
+		SurfaceTimeout,
+		SurfaceOutdated,
+		SurfaceLost,
+		SurfaceError,
+	};
+
+	template<typename T>
+	using result = std::expected<T, error_code>;
+
+	inline std::string_view error_message(error_code code) {
+		switch (code) {
+		case error_code::None: return "No error";
+		case error_code::NoAdapter: return "Failed to find an adapter matching any of the preferred adapter types!";
+		case error_code::AdapterQueryFailed: return "Failed to query the adapter!";
+		case error_code::MissingFeature: return "The selected adapter doesn't support a required feature!";
+		case error_code::DeviceCreationFailed: return "Failed to create device!";
+		case error_code::DeviceLost: return "The device has been lost!";
+		case error_code::MapFailed: return "Failed to map buffer!";
+		case error_code::SurfaceTimeout: return "Failed to get next surface texture: Timed out";
+		case error_code::SurfaceOutdated: return "Failed to get next surface texture: Outdated";
+		case error_code::SurfaceLost: return "Failed to get next surface texture: Current Texture Lost";
+		case error_code::SurfaceError: return "Failed to get next surface texture: Unknown Error";
+		}
+		return "Unknown error";
+	}
+
+	// The message is only evaluated if a handler is listening for the severity
+	#define STYLIZER_API_REPORT(severity, message, tag) do {                                                           \
+		if (auto stylizer_report_severity = (severity); stylizer::error_reporting_enabled(stylizer_report_severity)) \
+			stylizer::get_error_handler()(stylizer_report_severity, (message), (tag));                                 \
+	} while(false)
+
 	#ifndef STYLIZER_NO_EXCEPTIONS
-		#define STYLIZER_API_THROW(x) (get_error_handler()(stylizer::error_severity::Error, (x), 0), throw error(x))
+		[[noreturn]] inline void report_and_throw(std::string_view message) {
+			if (error_reporting_enabled(error_severity::Error))
+				get_error_handler()(error_severity::Error, message, 0);
+			throw error(message);
+		}
+		#define STYLIZER_API_THROW(x) stylizer::api::report_and_throw(x)
 	#else
-		#define STYLIZER_API_THROW(x) (get_error_handler()(stylizer::error_severity::Error, (x), 0), assert(false))
+		#define STYLIZER_API_THROW(x) ((stylizer::error_reporting_enabled(stylizer::error_severity::Error) ? stylizer::get_error_handler()(stylizer::error_severity::Error, (x), 0) : void()), assert(false))
 	#endif
 	#include "texture_format.partial.h"
 
@@ -86,8 +146,24 @@ namespace stylizer::api {
 		Index = (1 << 7),
 		MapRead = (1 << 10),
 		MapWrite = (1 << 11),
+		Indirect = (1 << 12), // Buffers holding the arguments of indirect draws/dispatches
 	};
 
+	enum class feature {
+		None = 0,
+		Float32Filterable = (1 << 0),
+		ShaderF16 = (1 << 1),
+		Subgroups = (1 << 2),
+		TimestampQuery = (1 << 3),
+		IndirectFirstInstance = (1 << 4),
+		DepthClipControl = (1 << 5),
+		DualSourceBlending = (1 << 6),
+		TextureCompressionBC = (1 << 7),
+	};
+
+	// Features which change what shader code is able to do (see shader::wgsl_enable_directives)
+	constexpr static feature shader_feature_mask = feature::ShaderF16 | feature::Subgroups | feature::DualSourceBlending;
+
 	enum class shader_language {
 		SPIRV,
 		GLSL,
@@ -215,11 +291,14 @@ namespace stylizer::api {
 		std::optional<stencil_config> stencil = {};
 	};
 
+	// Tag selecting overloads which return a reference to a per-thread temporary, only valid until STYLIZER_API_TEMPORARY_RING_SIZE (16)
+	// more temporaries of the same type are created on that thread (see util/temporary_storage.hpp)
 	struct temporary_return_t {};
 
 	constexpr static temporary_return_t temporary_return;
 
 	struct device;
+	struct render_bundle;
 
 	struct surface {
 		struct texture_acquisition_failed : public error {
@@ -250,6 +329,7 @@ namespace stylizer::api {
 		virtual surface& configure(device& device, const config& config) = 0;
 
 		virtual struct texture& next_texture(temporary_return_t, device& device) = 0;
+		virtual result<struct texture*> try_next_texture(temporary_return_t, device& device) = 0;
 
 		virtual texture_format configured_texture_format(device& device);
 
@@ -417,6 +497,10 @@ namespace stylizer::api {
 
 		virtual std::byte* map(device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) = 0;
 
+		virtual std::future<result<std::byte*>> try_map_async(device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) = 0;
+
+		virtual result<std::byte*> try_map(device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) = 0;
+
 		virtual void unmap() = 0;
 
 		virtual operator bool() const { return false; }
@@ -452,6 +536,24 @@ namespace stylizer::api {
 			}
 		}
 
+		// Enable directives which should be prepended to WGSL source to make use of the given features
+		static std::string wgsl_enable_directives(enum feature features) {
+			std::string out;
+			if (flags_set(features, feature::ShaderF16)) out += "enable f16;\n";
+			if (flags_set(features, feature::Subgroups)) out += "enable subgroups;\n";
+			if (flags_set(features, feature::DualSourceBlending)) out += "enable dual_source_blending;\n";
+			return out;
+		}
+
+		// Preprocessor defines (for Slang and GLSL) so a shader can select a variant for the given features
+		static std::string preprocessor_defines(enum feature features) {
+			std::string out;
+			if (flags_set(features, feature::ShaderF16)) out += "#define STYLIZER_FEATURE_SHADER_F16 1\n";
+			if (flags_set(features, feature::Subgroups)) out += "#define STYLIZER_FEATURE_SUBGROUPS 1\n";
+			if (flags_set(features, feature::DualSourceBlending)) out += "#define STYLIZER_FEATURE_DUAL_SOURCE_BLENDING 1\n";
+			return out;
+		}
+
 		template<typename T>
 		inline static T create_from_source(device& device, language lang, stage stage, const std::string_view source, std::optional<const std::string_view> entry_point_ = "main", const std::string_view label = "Stylizer Shader") {
 			auto entry_point = entry_point_.value_or("main");
@@ -498,15 +600,18 @@ namespace stylizer::api {
 	};
 
 	struct command_buffer {
-		stylizer::signal<void()> deferred_to_release;
+		stylizer::deferred_action_list<> deferred_to_release;
 
-		template<std::convertible_to<std::function<void>> Tfunc>
+		template<std::invocable Tfunc>
 		command_buffer& defer(Tfunc&& func) {
-			deferred_to_release.connect(std::move(func));
+			deferred_to_release.push(std::forward<Tfunc>(func));
 			return *this;
 		}
 
-		virtual void submit(device& device, bool release = true) = 0;
+		// Returns the serial of the submission (see device::completed_serial)
+		virtual uint64_t submit(device& device, bool release = true) = 0;
+
+		virtual result<uint64_t> try_submit(device& device, bool release = true) = 0;
 
 		virtual operator bool() const { return false; }
 
@@ -574,7 +679,7 @@ namespace stylizer::api {
 	struct command_encoder_base {
 		using pipeline = compute_pipeline;
 
-		virtual Treturn& defer(std::function<void()>&& func) = 0;
+		virtual Treturn& defer(stylizer::deferred_action&& func) = 0;
 
 		virtual Treturn& copy_buffer_to_buffer(device& device, buffer& destination, const buffer& source, std::optional<size_t> destination_offset = 0, std::optional<size_t> source_offset = 0, std::optional<size_t> size_override = {}) = 0;
 
@@ -590,9 +695,19 @@ namespace stylizer::api {
 
 		virtual Treturn& dispatch_workgroups(device& device, vec3u workgroups) = 0;
 
+		// Dispatches using workgroup counts (3 x uint32) read from the buffer at offset when the command executes
+		virtual Treturn& dispatch_workgroups_indirect(device& device, const buffer& indirect_buffer, size_t offset = 0) = 0;
+
+		// Explicitly starts a new compute pass (ending whatever pass is currently open), bind and dispatch calls open one automatically when needed
+		virtual Treturn& begin_compute_pass(device& device) = 0;
+
+		// Ends whatever pass is currently open, so that following commands are recorded after it
+		// NOTE: Render passes forget their attachments, so begin_render_pass must be called again before drawing
+		virtual Treturn& end_pass(device& device) = 0;
+
 		virtual command_buffer& end(temporary_return_t, device& device) = 0;
 
-		virtual void one_shot_submit(device& device) = 0;
+		virtual uint64_t one_shot_submit(device& device) = 0;
 
 		virtual operator bool() const { return false; }
 
@@ -609,7 +724,7 @@ namespace stylizer::api {
 
 	template<typename T>
 	concept command_encoder_concept = std::derived_from<T, command_encoder> && requires(T t, device device, bool one_shot, const std::string_view label) {
-		{ t.deferred_to_release } -> convertible_to_pointer<stylizer::signal<void()>>;
+		{ t.deferred_to_release } -> std::convertible_to<stylizer::deferred_action_list<>&>;
 		{ T::create(device, one_shot, label) } -> std::convertible_to<T>;
 		{ t.auto_release() } -> std::convertible_to<auto_release<T>>;
 		{ t.type } -> std::convertible_to<size_t>;
@@ -620,12 +735,20 @@ namespace stylizer::api {
 		using pipeline = compute_pipeline;
 	}
 
+	// NOTE: Commands which can't be recorded inside of a render pass (copies and compute work) split it: the render pass
+	// 	is ended, the command recorded, and the pass resumed by the next render command. Resuming loads the attachments
+	// 	and rebinds the pipeline, bind groups (0-7) and vertex (0-15) and index buffers, so everything bound must stay
+	// 	alive until the pass is ended. Attachments which aren't stored lose their contents at a split and are cleared
+	// 	again when resumed (which is reported as a warning), so avoid splitting such passes.
 	struct render_pass : public command_encoder_base<render_pass> {
 		using blend_state = api::blend_state;
 		using color_attachment = api::color_attachment;
 		using depth_stencil_attachment = api::depth_stencil_attachment;
 		using pipeline = struct render_pipeline;
 
+		// Ends whatever pass is currently open and starts a new render pass targeting the provided attachments, all following render commands are recorded into it
+		virtual render_pass& begin_render_pass(device& device, std::span<const color_attachment> colors, const std::optional<depth_stencil_attachment>& depth = {}) = 0;
+
 		virtual render_pass& bind_render_pipeline(device& device, const render_pipeline& pipeline, bool release_on_submit = false) = 0;
 
 		virtual render_pass& bind_render_group(device& device, const bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) = 0;
@@ -638,6 +761,15 @@ namespace stylizer::api {
 
 		virtual render_pass& draw_indexed(device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) = 0;
 
+		// Draws using arguments (vertex count, instance count, first vertex, first instance as uint32s) read from the buffer at offset when the command executes
+		virtual render_pass& draw_indirect(device& device, const buffer& indirect_buffer, size_t offset = 0) = 0;
+
+		// Draws using arguments (index count, instance count, first index, base vertex, first instance as uint32s, base vertex signed) read from the buffer at offset when the command executes
+		virtual render_pass& draw_indexed_indirect(device& device, const buffer& indirect_buffer, size_t offset = 0) = 0;
+
+		// Replays previously recorded (finished) bundles, afterwards the pipeline, bind groups and buffers must be bound again
+		virtual render_pass& execute_bundles(device& device, std::span<const render_bundle* const> bundles) = 0;
+
 		virtual operator bool() const { return false; }
 
 		virtual void release() = 0;
@@ -762,20 +894,184 @@ namespace stylizer::api {
 		{ t.type } -> std::convertible_to<size_t>;
 	};
 
+	// A sequence of render commands which is recorded once and then replayed (cheaply) by any render pass with compatible attachments
+	struct render_bundle {
+		using color_attachment = api::color_attachment;
+		using depth_stencil_attachment = api::depth_stencil_attachment;
+
+		virtual render_bundle& bind_render_pipeline(device& device, const render_pipeline& pipeline) = 0;
+
+		virtual render_bundle& bind_render_group(device& device, const bind_group& group, std::optional<size_t> index_override = {}) = 0;
+
+		virtual render_bundle& bind_vertex_buffer(device& device, size_t slot, const buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) = 0;
+
+		virtual render_bundle& bind_index_buffer(device& device, const buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) = 0;
+
+		virtual render_bundle& draw(device& device, size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) = 0;
+
+		virtual render_bundle& draw_indexed(device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) = 0;
+
+		virtual render_bundle& draw_indirect(device& device, const buffer& indirect_buffer, size_t offset = 0) = 0;
+
+		virtual render_bundle& draw_indexed_indirect(device& device, const buffer& indirect_buffer, size_t offset = 0) = 0;
+
+		// Stops recording, after which the bundle can be executed (but no longer recorded into)
+		virtual render_bundle& finish(device& device) = 0;
+
+		virtual bool finished() const = 0;
+
+		virtual operator bool() const { return false; }
+
+		virtual void release() = 0;
+
+		virtual ~render_bundle() = default;
+
+		STYLIZER_API_AS_METHOD(render_bundle);
+
+		STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_METHOD(render_bundle);
+	};
+
+	template<typename T>
+	concept render_bundle_concept = std::derived_from<T, render_bundle> && requires(T t, device device, std::span<const color_attachment> color_attachments, std::optional<depth_stencil_attachment> depth_attachment, const std::string_view label) {
+		{ T::create(device, color_attachments, depth_attachment, label) } -> std::convertible_to<T>;
+		{ t.auto_release() } -> std::convertible_to<auto_release<T>>;
+		{ t.type } -> std::convertible_to<size_t>;
+	};
+
 	namespace render {
 		using pass = render_pass;
 		using pipeline = render_pipeline;
+		using bundle = render_bundle;
 	}
 
+	enum class adapter_type {
+		Hardware, // A physical GPU (discrete or integrated)
+		Software, // A CPU implementation of the backend (SwiftShader, lavapipe, WARP, etc...)
+		Null, // An adapter which accepts all commands but never executes anything (useful for headless testing)
+	};
+
+	constexpr static std::array<adapter_type, 1> hardware_adapter_preference = { adapter_type::Hardware };
+	constexpr static std::array<adapter_type, 2> hardware_or_software_adapter_preference = { adapter_type::Hardware, adapter_type::Software };
+	constexpr static std::array<adapter_type, 3> any_adapter_preference = { adapter_type::Hardware, adapter_type::Software, adapter_type::Null };
+
+	struct adapter_info {
+		enum adapter_type adapter_type = adapter_type::Hardware;
+		std::string vendor;
+		std::string architecture;
+		std::string name;
+		std::string description;
+		std::string backend;
+	};
+
+	// NOTE: When requesting limits a value of 0 means "use the default"
+	struct device_limits {
+		uint32_t max_texture_dimension_1D = 0;
+		uint32_t max_texture_dimension_2D = 0;
+		uint32_t max_texture_dimension_3D = 0;
+		uint32_t max_texture_array_layers = 0;
+		uint32_t max_bind_groups = 0;
+		uint32_t max_bind_groups_plus_vertex_buffers = 0;
+		uint32_t max_bindings_per_bind_group = 0;
+		uint32_t max_dynamic_uniform_buffers_per_pipeline_layout = 0;
+		uint32_t max_dynamic_storage_buffers_per_pipeline_layout = 0;
+		uint32_t max_sampled_textures_per_shader_stage = 0;
+		uint32_t max_samplers_per_shader_stage = 0;
+		uint32_t max_storage_buffers_per_shader_stage = 0;
+		uint32_t max_storage_textures_per_shader_stage = 0;
+		uint32_t max_uniform_buffers_per_shader_stage = 0;
+		uint64_t max_uniform_buffer_binding_size = 0;
+		uint64_t max_storage_buffer_binding_size = 0;
+		uint32_t min_uniform_buffer_offset_alignment = 0;
+		uint32_t min_storage_buffer_offset_alignment = 0;
+		uint32_t max_vertex_buffers = 0;
+		uint64_t max_buffer_size = 0;
+		uint32_t max_vertex_attributes = 0;
+		uint32_t max_vertex_buffer_array_stride = 0;
+		uint32_t max_inter_stage_shader_variables = 0;
+		uint32_t max_color_attachments = 0;
+		uint32_t max_color_attachment_bytes_per_sample = 0;
+		uint32_t max_compute_workgroup_storage_size = 0;
+		uint32_t max_compute_invocations_per_workgroup = 0;
+		uint32_t max_compute_workgroup_size_x = 0;
+		uint32_t max_compute_workgroup_size_y = 0;
+		uint32_t max_compute_workgroup_size_z = 0;
+		uint32_t max_compute_workgroups_per_dimension = 0;
+	};
+
 	struct device {
+		enum class performance_profile {
+			// Full validation and robustness plus extra debugging aids (backend labels, unmangled shader symbols).
+			// Slowest, but errors are reported as soon as they happen and are easy to trace back to their source.
+			Debug,
+			// Backend defaults: full validation, robust buffer access and zero initialized resources.
+			// Invalid usage is always caught and reported, out of bounds accesses can never read or write outside a resource.
+			Balanced,
+			// Validation, robustness and lazy zero initialization are all disabled and errors are reported asynchronously.
+			// Only use with pipelines and command streams which have already been tested under Debug or Balanced!
+			// Invalid usage is undefined behavior (potentially a driver crash or device loss), out of bounds
+			// shader accesses are unchecked, and freshly created resources may contain stale data from other allocations.
+			Throughput,
+		};
+
+		enum class wait_strategy {
+			// Sleep inside the driver until the GPU signals completion (no CPU usage while waiting)
+			Block,
+			// Busy poll for wait_spin_duration (lowest latency for short waits), then poll once every wait_sleep_interval
+			SpinThenSleep,
+		};
+
 		struct create_config {
 			const std::string_view label = "Stylizer Device";
 			const std::string_view queue_label = "Stylizer Queue";
 			bool high_performance = true;
 			STYLIZER_NULLABLE struct surface* compatible_surface = nullptr;
+			// Adapter types which are tried in order, the first one available is used
+			std::span<const adapter_type> adapter_preference = hardware_adapter_preference;
+			enum performance_profile performance_profile = performance_profile::Balanced;
+			// When set every limit is raised to the best the adapter supports (values in required_limits are ignored)
+			bool request_best_limits = false;
+			// Only non-zero values are requested, everything else gets the WebGPU defaults
+			device_limits required_limits = {};
+			// Directory where compiled shaders and pipelines are persisted between runs (disabled when empty)
+			std::string_view cache_directory = {};
+			enum wait_strategy wait_strategy = wait_strategy::Block;
+			std::chrono::microseconds wait_spin_duration = std::chrono::microseconds(50);
+			std::chrono::microseconds wait_sleep_interval = std::chrono::microseconds(250);
+			// Device creation fails if any of these features are unavailable
+			enum feature required_features = feature::Float32Filterable;
+			// These features are enabled if the adapter supports them
+			enum feature preferred_features = feature::None;
 		};
 
-		virtual bool tick(bool wait_for_queues = true) = 0;
+		// Processes any pending callbacks without blocking
+		virtual bool poll() = 0;
+
+		// Waits for all submitted work to finish (or just polls if wait_for_queues is false), returns false if the timeout expired first
+		virtual bool tick(bool wait_for_queues = true, std::optional<std::chrono::nanoseconds> timeout = {}) = 0;
+
+		// Submission serials increase monotonically with every submit, the completed serial advances as the device is polled or waited on
+		virtual uint64_t completed_serial() const = 0;
+
+		// Waits for the given submission (and every submission before it) to finish, returns false if the timeout expired first
+		// NOTE: Only serials already returned by submit may be waited on (waiting on a future serial is an error)
+		virtual bool wait(uint64_t serial, std::optional<std::chrono::nanoseconds> timeout = {}) = 0;
+
+		// Calls the callback once the given submission has finished (immediately if it already has)
+		virtual device& on_completed(uint64_t serial, std::function<void()>&& callback) = 0;
+
+		virtual adapter_info get_adapter_info() const = 0;
+
+		virtual device_limits limits() const = 0;
+
+		virtual enum feature features() const = 0;
+
+		// True once the device has been lost, after which the try_ variants return error_code::DeviceLost
+		virtual bool is_lost() const = 0;
+
+		bool has_feature(enum feature feature) const { return (features() & feature) == feature; }
+
+		// The subset of the enabled features which shaders can take advantage of
+		enum feature shader_features() const { return features() & shader_feature_mask; }
 
 		virtual texture& create_texture(temporary_return_t, const texture::create_config& config = {}) = 0;
 
@@ -802,12 +1098,17 @@ namespace stylizer::api {
 
 		virtual render_pass& create_render_pass(temporary_return_t, std::span<const render_pass::color_attachment> colors, const std::optional<render_pass::depth_stencil_attachment>& depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass") = 0;
 
+		// Creates a render pass without any attachments, render passes are started with `begin_render_pass` allowing a whole frame (many render and compute passes) to be recorded into one command buffer
+		virtual render_pass& create_command_recorder(temporary_return_t, bool one_shot = false, const std::string_view label = "Stylizer Command Recorder") = 0;
+
 		virtual compute_pipeline& create_compute_pipeline(temporary_return_t, const pipeline::entry_point& entry_point, const std::string_view label = "Stylizer Compute Pipeline") = 0;
 
 		virtual render_pipeline& create_render_pipeline(temporary_return_t, const pipeline::entry_points& entry_points, std::span<const color_attachment> color_attachments = {}, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline") = 0;
 
 		virtual render_pipeline& create_render_pipeline_from_compatible_render_pass(temporary_return_t, const pipeline::entry_points& entry_points, const render_pass& compatible_render_pass, const render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline") = 0;
 
+		virtual render_bundle& create_render_bundle(temporary_return_t, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle") = 0;
+
 		device& quick_compute_dispatch(vec3u workgroups, const pipeline::entry_point& entry_point, std::span<const bind_group::binding> bindings = {}) {
 			compute_pipeline::quick_dispatch(*this, workgroups, entry_point, bindings);
 			return *this;
@@ -815,7 +1116,7 @@ namespace stylizer::api {
 
 		virtual operator bool() const { return false; }
 
-		virtual void release(bool static_sub_objects = false) = 0;
+		virtual void release() = 0;
 
 		virtual ~device() = default;
 
@@ -827,6 +1128,8 @@ namespace stylizer::api {
 	template<typename T>
 	concept device_concept = std::derived_from<T, device> && requires(T t, device::create_config config, texture::create_config texture_config, std::span<const render_pass::color_attachment> colors, std::optional<render_pass::depth_stencil_attachment> depth, bool one_shot, const std::string_view label, usage usage, size_t size, bool mapped_at_creation, std::span<const std::byte> data, size_t offset) {
 		{ T::create_default(config) } -> std::convertible_to<T>;
+		{ T::try_create_default(config) } -> std::convertible_to<result<T>>;
+		{ T::create_default_async(config) } -> std::convertible_to<std::future<T>>;
 		{ t.create_texture(texture_config) } -> std::derived_from<texture>;
 		{ t.create_buffer(usage, size, mapped_at_creation, label) } -> std::derived_from<buffer>;
 		{ t.create_and_write_buffer(usage, data, offset, label) } -> std::derived_from<buffer>;
@@ -835,6 +1138,14 @@ namespace stylizer::api {
 		{ t.type } -> std::convertible_to<size_t>;
 	};
 
+	// A backend is described by a tag type naming its concrete implementations (see static_dispatch.hpp)
+	template<typename T>
+	concept backend_concept = requires {
+		typename T::device;
+		typename T::command_encoder;
+		typename T::render_pass;
+	} && std::derived_from<typename T::device, device> && command_encoder_concept<typename T::command_encoder> && render_pass_concept<typename T::render_pass>;
+
 	inline texture::format surface::configured_texture_format(device& device) {
 		auto texture = std::unique_ptr<struct texture>(next_texture(temporary_return, device).move_temporary_to_heap());
 		auto out = texture->texture_format();
@@ -2,7 +2,11 @@
 
 #if STYLIZER_CURRENT_BACKEND == 1 // TODO: Replace with platform decision logic
 	#include "webgpu/webgpu.hpp"
+	#include "../static_dispatch.hpp"
 	namespace stylizer::api::current_backend {
 		using namespace webgpu;
+		using static_device = api::static_device<webgpu::backend>;
+		using static_command_encoder = api::static_command_encoder<webgpu::backend>;
+		using static_render_pass = api::static_render_pass<webgpu::backend>;
 	}
 #endif
\ No newline at end of file
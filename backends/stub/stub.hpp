@@ -96,6 +96,8 @@ namespace stylizer::api::stub {
 
 		std::future<std::byte*> map_async(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		std::byte* map(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		std::future<result<std::byte*>> try_map_async(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		result<std::byte*> try_map(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		std::byte* get_mapped_range(bool for_writing = false, size_t offset = 0, std::optional<size_t> size = {}) { STYLIZER_API_THROW("Not implemented yet!"); }
 
@@ -131,7 +133,8 @@ namespace stylizer::api::stub {
 		command_buffer& operator=(command_buffer&& o) { STYLIZER_API_THROW("Not implemented yet!"); }
 		inline operator bool() const override { STYLIZER_API_THROW("Not implemented yet!"); }
 
-		void submit(api::device& device, bool release = true) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		uint64_t submit(api::device& device, bool release = true) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		result<uint64_t> try_submit(api::device& device, bool release = true) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		void release() override { STYLIZER_API_THROW("Not implemented yet!"); }
 		stylizer::auto_release<command_buffer> auto_release() { return std::move(*this); }
 	};
@@ -167,7 +170,7 @@ namespace stylizer::api::stub {
 	template<typename Tapi_return, typename Twebgpu_return>
 	struct command_encoder_base : public Tapi_return { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(command_encoder_base);
 		uint32_t type = magic_number;
-		std::shared_ptr<stylizer::signal<void()>> deferred_to_release = std::make_shared<stylizer::signal<void()>>();
+		stylizer::deferred_action_list<> deferred_to_release;
 
 		inline command_encoder_base(command_encoder_base&& o) { *this = std::move(o); }
 		inline command_encoder_base& operator=(command_encoder_base&& o) { STYLIZER_API_THROW("Not implemented yet!"); }
@@ -179,7 +182,7 @@ namespace stylizer::api::stub {
 
 		template<typename Tfunc>
 		Twebgpu_return& defer(Tfunc&& func) { STYLIZER_API_THROW("Not implemented yet!"); }
-		Tapi_return& defer(std::function<void()>&& func) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		Tapi_return& defer(stylizer::deferred_action&& func) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		Tapi_return& copy_buffer_to_buffer(api::device& device, api::buffer& destination, const api::buffer& source, std::optional<size_t> destination_offset = 0, std::optional<size_t> source_offset = 0, std::optional<size_t> size_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		Tapi_return& copy_buffer_to_texture(api::device& device, api::buffer& destination, const api::texture& source, std::optional<size_t> destination_offset = 0, std::optional<vec3u> source_origin = { { 0, 0, 0 } }, std::optional<vec3u> extent_override = {}, std::optional<size_t> min_mip_level = 0, std::optional<size_t> mip_levels_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
@@ -189,11 +192,14 @@ namespace stylizer::api::stub {
 		Tapi_return& bind_compute_pipeline(api::device& device, const api::compute_pipeline& pipeline, bool release_on_submit = false) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		Tapi_return& bind_compute_group(api::device& device, const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		Tapi_return& dispatch_workgroups(api::device& device, vec3u workgroups) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		Tapi_return& dispatch_workgroups_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		Tapi_return& begin_compute_pass(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		Tapi_return& end_pass(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		stub::command_buffer end(api::device& device) { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::command_buffer& end(temporary_return_t, api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
-		void one_shot_submit(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		uint64_t one_shot_submit(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		void release() override { STYLIZER_API_THROW("Not implemented yet!"); }
 	};
@@ -224,6 +230,8 @@ namespace stylizer::api::stub {
 
 		static stub::render_pass create(api::device& device, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass") { STYLIZER_API_THROW("Not implemented yet!"); }
 
+		api::render_pass& begin_render_pass(api::device& device, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
 		api::render_pass& bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline, bool release_on_submit =  false) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::render_pass& bind_render_group(api::device& device, const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::render_pass& bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
@@ -231,11 +239,15 @@ namespace stylizer::api::stub {
 
 		api::render_pass& draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::render_pass& draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_pass& draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_pass& draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		api::render_pass& execute_bundles(api::device& device, std::span<const api::render_bundle* const> bundles) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		stub::command_buffer end(api::device& device) { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::command_buffer& end(temporary_return_t, api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
-		void one_shot_submit(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		uint64_t one_shot_submit(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		void release() override { STYLIZER_API_THROW("Not implemented yet!"); }
 		stylizer::auto_release<render_pass> auto_release() { return std::move(*this); }
@@ -261,9 +273,37 @@ namespace stylizer::api::stub {
 	};
 	static_assert(render_pipeline_concept<render_pipeline>);
 
+	struct render_bundle : public api::render_bundle { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(render_bundle); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(render_bundle);
+		uint32_t type = magic_number;
+
+		render_bundle(render_bundle&& o) { *this = std::move(o); }
+		render_bundle& operator=(render_bundle&& o) { STYLIZER_API_THROW("Not implemented yet!"); }
+		inline operator bool() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+		inline bool finished() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		static render_bundle create(api::device& device, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle") { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		api::render_bundle& bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& bind_render_group(api::device& device, const api::bind_group& group, std::optional<size_t> index_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& bind_index_buffer(api::device& device, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		api::render_bundle& draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		api::render_bundle& finish(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		void release() override { STYLIZER_API_THROW("Not implemented yet!"); }
+		stylizer::auto_release<render_bundle> auto_release() { return std::move(*this); }
+	};
+	static_assert(render_bundle_concept<render_bundle>);
+
 	namespace render {
 		using pipeline = render_pipeline;
 		using pass = render_pass;
+		using bundle = render_bundle;
 	}
 
 	struct surface : public api::surface { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(surface);  STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(surface);
@@ -284,7 +324,9 @@ namespace stylizer::api::stub {
 		api::surface& configure(api::device& device, const config& config) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		stub::texture next_texture(api::device& device) { STYLIZER_API_THROW("Not implemented yet!"); }
+		result<stub::texture> try_next_texture(api::device& device) { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::texture& next_texture(temporary_return_t, api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		result<api::texture*> try_next_texture(temporary_return_t, api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		texture::format configured_texture_format(api::device& device) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
@@ -303,8 +345,22 @@ namespace stylizer::api::stub {
 		inline operator bool() const override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		static stub::device create_default(const stub::device::create_config& config = {}) { STYLIZER_API_THROW("Not implemented yet!"); }
+		static result<stub::device> try_create_default(const stub::device::create_config& config = {}) { STYLIZER_API_THROW("Not implemented yet!"); }
+		static std::future<stub::device> create_default_async(const stub::device::create_config& config = {}) { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		bool poll() override { STYLIZER_API_THROW("Not implemented yet!"); }
+		bool tick(bool wait_for_queues = true, std::optional<std::chrono::nanoseconds> timeout = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		uint64_t completed_serial() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+		bool wait(uint64_t serial, std::optional<std::chrono::nanoseconds> timeout = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::device& on_completed(uint64_t serial, std::function<void()>&& callback) override { STYLIZER_API_THROW("Not implemented yet!"); }
 
-		bool tick(bool wait_for_queues = true) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		adapter_info get_adapter_info() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		device_limits limits() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		enum feature features() const override { STYLIZER_API_THROW("Not implemented yet!"); }
+		bool is_lost() const override { STYLIZER_API_THROW("Not implemented yet!"); }
 
 		stub::texture create_texture(const api::texture::create_config& config = {}) { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::texture& create_texture(temporary_return_t, const api::texture::create_config& config = {}) override { STYLIZER_API_THROW("Not implemented yet!"); }
@@ -335,6 +391,9 @@ namespace stylizer::api::stub {
 		stub::render_pass create_render_pass(std::span<const api::render_pass::color_attachment> colors, std::optional<api::render_pass::depth_stencil_attachment> depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass") { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::render_pass& create_render_pass(temporary_return_t, std::span<const api::render_pass::color_attachment> colors, const std::optional<api::render_pass::depth_stencil_attachment>& depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass") override { STYLIZER_API_THROW("Not implemented yet!"); }
 
+		stub::render_pass create_command_recorder(bool one_shot = false, const std::string_view label = "Stylizer Command Recorder") { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_pass& create_command_recorder(temporary_return_t, bool one_shot = false, const std::string_view label = "Stylizer Command Recorder") override { STYLIZER_API_THROW("Not implemented yet!"); }
+
 		stub::compute_pipeline create_compute_pipeline(const pipeline::entry_point& entry_point, const std::string_view label = "Stylizer Compute Pipeline") { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::compute_pipeline& create_compute_pipeline(temporary_return_t, const pipeline::entry_point& entry_point, const std::string_view label = "Stylizer Compute Pipeline") override { STYLIZER_API_THROW("Not implemented yet!"); }
 
@@ -343,7 +402,10 @@ namespace stylizer::api::stub {
 		stub::render_pipeline create_render_pipeline_from_compatible_render_pass(const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline") { STYLIZER_API_THROW("Not implemented yet!"); }
 		api::render_pipeline& create_render_pipeline_from_compatible_render_pass(temporary_return_t, const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline") override { STYLIZER_API_THROW("Not implemented yet!"); }
 
-		void release(bool static_sub_objects = false) override { STYLIZER_API_THROW("Not implemented yet!"); }
+		stub::render_bundle create_render_bundle(std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle") { STYLIZER_API_THROW("Not implemented yet!"); }
+		api::render_bundle& create_render_bundle(temporary_return_t, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle") override { STYLIZER_API_THROW("Not implemented yet!"); }
+
+		void release() override { STYLIZER_API_THROW("Not implemented yet!"); }
 		stylizer::auto_release<device> auto_release() { return std::move(*this); }
 	};
 	static_assert(device_concept<device>);
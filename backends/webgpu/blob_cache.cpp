@@ -0,0 +1,112 @@
+#include "common.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+namespace stylizer::api::webgpu {
+
+	// Each entry is stored as its own file named after a hash of its key:
+	//  [uint64_t key size][key bytes][value bytes]
+	// The key is stored so that hash collisions are detected instead of handing Dawn the wrong blob.
+	struct blob_cache {
+		std::filesystem::path directory;
+
+		// Unique across processes sharing the directory (random per process token) and across writes within a process (counter)
+		static std::string temporary_suffix() {
+			static const uint64_t process_token = (uint64_t(std::random_device{}()) << 32) ^ std::random_device{}()
+				^ std::chrono::steady_clock::now().time_since_epoch().count();
+			static std::atomic<uint64_t> counter = 0;
+			char suffix[2 * 16 + 8];
+			std::snprintf(suffix, sizeof(suffix), ".%016" PRIx64 ".%" PRIx64 ".tmp", process_token, counter++);
+			return suffix;
+		}
+
+		std::filesystem::path path_for(std::string_view key) const {
+			char name[2 * sizeof(size_t) + 6];
+			std::snprintf(name, sizeof(name), "%0*zx.blob", int(2 * sizeof(size_t)), std::hash<std::string_view>{}(key));
+			return directory / name;
+		}
+
+		size_t load(std::string_view key, void* value, size_t value_size) const {
+			std::ifstream file(path_for(key), std::ios::binary | std::ios::ate);
+			if (!file) return 0;
+			size_t file_size = file.tellg();
+			file.seekg(0);
+
+			uint64_t key_size = 0;
+			if (!file.read((char*)&key_size, sizeof(key_size)) || key_size != key.size() || file_size < sizeof(key_size) + key_size)
+				return 0;
+			std::string stored_key(key_size, '\0');
+			if (!file.read(stored_key.data(), key_size) || stored_key != key)
+				return 0;
+
+			size_t size = file_size - sizeof(key_size) - key_size;
+			if (value == nullptr) return size; // Dawn is asking how big the value is
+			if (value_size < size || !file.read((char*)value, size))
+				return 0;
+			return size;
+		}
+
+		void store(std::string_view key, const void* value, size_t value_size) const {
+			auto path = path_for(key);
+			// Write to a uniquely named file and then move it into place so concurrent readers (or processes) never see a partial entry
+			auto temporary = path;
+			temporary += temporary_suffix();
+			{
+				std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+				uint64_t key_size = key.size();
+				file.write((const char*)&key_size, sizeof(key_size));
+				file.write(key.data(), key.size());
+				file.write((const char*)value, value_size);
+				if (!file) {
+					STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to write pipeline cache entry: " + temporary.string(), 0);
+					return;
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename(temporary, path, error);
+			if (error) {
+				std::filesystem::remove(temporary, error);
+				STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to store pipeline cache entry: " + path.string(), 0);
+			}
+		}
+	};
+
+	WGPUDawnCacheDeviceDescriptor create_blob_cache_descriptor(std::string_view directory) {
+		// NOTE: Dawn may call into the cache for as long as anything still references the device, so caches are kept alive
+		//  for the remainder of the program (one per directory, shared between every device using that directory)
+		static std::mutex mutex;
+		static std::unordered_map<std::string, std::unique_ptr<blob_cache>> caches;
+
+		blob_cache* cache;
+		{
+			std::scoped_lock lock(mutex);
+			auto& slot = caches[std::string(directory)];
+			if (!slot) {
+				slot = std::make_unique<blob_cache>(std::filesystem::path(directory));
+				std::error_code error;
+				std::filesystem::create_directories(slot->directory, error);
+				if (error) STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to create pipeline cache directory: " + slot->directory.string(), 0);
+			}
+			cache = slot.get();
+		}
+
+		WGPUDawnCacheDeviceDescriptor out = WGPU_DAWN_CACHE_DEVICE_DESCRIPTOR_INIT;
+		out.loadDataFunction = [](const void* key, size_t key_size, void* value, size_t value_size, void* userdata) -> size_t {
+			return ((blob_cache*)userdata)->load({(const char*)key, key_size}, value, value_size);
+		};
+		out.storeDataFunction = [](const void* key, size_t key_size, const void* value, size_t value_size, void* userdata) {
+			((blob_cache*)userdata)->store({(const char*)key, key_size}, value, value_size);
+		};
+		out.functionUserdata = cache;
+		return out;
+	}
+} // namespace stylizer::api::webgpu
@@ -1,5 +1,8 @@
 #include "common.hpp"
 
+#include <algorithm>
+#include <bit>
+
 namespace stylizer::api::webgpu {
 	inline usage from_webgpu(WGPUBufferUsage usage) {
 		enum usage out = usage::Invalid;
@@ -11,6 +14,7 @@ namespace stylizer::api::webgpu {
 		if(flags_set(usage,WGPUBufferUsage_Vertex)) out |= usage::Vertex;
 		if(flags_set(usage,WGPUBufferUsage_Uniform)) out |= usage::Uniform;
 		if(flags_set(usage,WGPUBufferUsage_Storage)) out |= usage::Storage;
+		if(flags_set(usage,WGPUBufferUsage_Indirect)) out |= usage::Indirect;
 		if(out == usage::Invalid) STYLIZER_API_THROW(std::string("Failed to find buffer usage: ") + std::to_string(usage));
 		return out;
 	};
@@ -25,6 +29,7 @@ namespace stylizer::api::webgpu {
 		if(flags_set(usage, usage::Vertex)) out |= WGPUBufferUsage_Vertex;
 		if(flags_set(usage, usage::Uniform)) out |= WGPUBufferUsage_Uniform;
 		if(flags_set(usage, usage::Storage)) out |= WGPUBufferUsage_Storage;
+		if(flags_set(usage, usage::Indirect)) out |= WGPUBufferUsage_Indirect;
 		if(out == 0) STYLIZER_API_THROW(std::string("Failed to find buffer usage: ") + std::string(magic_enum::enum_name(usage)));
 		return out;
 	}
@@ -34,11 +39,13 @@ namespace stylizer::api::webgpu {
 
 		buffer out;
 		WGPUBufferDescriptor d = WGPU_BUFFER_DESCRIPTOR_INIT;
-		d.label = to_webgpu(label);
+		d.label = to_webgpu_label(label);
 		d.usage = to_webgpu(usage);
 		d.size = size;
 		d.mappedAtCreation = mapped_at_creation;
 		out.buffer_ = wgpuDeviceCreateBuffer(device.device_, &d);
+		out.size_ = size;
+		out.usage_ = from_webgpu(d.usage);
 		return out;
 	}
 
@@ -48,24 +55,20 @@ namespace stylizer::api::webgpu {
 		return out;
 	}
 
-	const buffer& buffer::zero_buffer(api::device& device, enum usage usage /* = usage::Storage */, size_t minimum_size /* = 0 */, api::buffer* just_released /* = nullptr */) {
-		static constexpr auto create = [](api::device& device, enum usage usage, size_t minimum_size) {
-			std::vector<std::byte> data(minimum_size, std::byte { 0 });
-			return create_and_write(device, usage, data, 0, "Stylizer Zero Buffer");
-		};
-		static std::unordered_map<enum usage, stylizer::auto_release<buffer>> buffers;
-
-		if (!buffers.contains(usage))
-			buffers[usage] = create(device, usage, minimum_size);
-
-		if (buffers[usage].size() < minimum_size) {
-			if (just_released) confirm_webgpu_type<webgpu::buffer>(*just_released) = std::move(buffers[usage]);
-			else buffers[usage].release();
-
-			buffers[usage] = create(device, usage, minimum_size);
-		}
-
-		return buffers[usage];
+	const buffer& buffer::zero_buffer(api::device& device_, enum usage usage /* = usage::Storage */, size_t minimum_size /* = 0 */, api::buffer* just_released /* = nullptr */) {
+		auto& device = confirm_webgpu_type<webgpu::device>(device_);
+		std::scoped_lock lock(device.caches->mutex);
+		auto& buffers = device.caches->zero_buffers[usage];
+
+		// NOTE: Entries are never replaced or removed (and map nodes never move), so the returned reference stays valid
+		// 	for the device's lifetime no matter what other threads request. Nothing is ever handed to just_released.
+		if (auto found = buffers.lower_bound(minimum_size); found != buffers.end())
+			return found->second;
+
+		// Sizes are rounded up to a power of two so growing requests only create a logarithmic number of buffers
+		size_t size = std::bit_ceil(std::max<size_t>(minimum_size, 16));
+		std::vector<std::byte> data(size, std::byte{ 0 });
+		return buffers.emplace(size, create_and_write(device, usage, data, 0, "Stylizer Zero Buffer")).first->second;
 	}
 	const api::buffer& buffer::get_zero_buffer_singleton(api::device& device, enum usage usage /* = usage::Storage */, size_t size /* = 0 */, api::buffer* just_released /* = nullptr */) {
 		return webgpu::buffer::zero_buffer(device, usage, size, just_released);
@@ -77,10 +80,6 @@ namespace stylizer::api::webgpu {
 		return *this;
 	}
 
-	size_t buffer::size() const { return wgpuBufferGetSize(buffer_); }
-
-	enum usage buffer::usage() const { return from_webgpu(wgpuBufferGetUsage(buffer_)); }
-
 	void copy_buffer_to_buffer_impl(WGPUCommandEncoder e, webgpu::buffer& destination, const webgpu::buffer& source, size_t destination_offset = 0, size_t source_offset = 0, std::optional<size_t> size_override = {}) {
 		size_t size = std::min(destination.size() - destination_offset, source.size() - source_offset);
 		assert(size_override.value_or(size) <= size);
@@ -93,7 +92,7 @@ namespace stylizer::api::webgpu {
 		auto e = create_command_encoder(device.device_);
 		defer_ { wgpuCommandEncoderRelease(e); };
 		copy_buffer_to_buffer_impl(e, *this, source, destination_offset.value_or(0), source_offset.value_or(0), size_override);
-		finish_and_submit(e, device.queue);
+		finish_and_submit(e, device);
 		return *this;
 	}
 
@@ -103,25 +102,39 @@ namespace stylizer::api::webgpu {
 		return false;
 	}
 
-	std::future<std::byte*> buffer::map_async(api::device& device, std::optional<bool> for_writing_ /* = false */, std::optional<size_t> offset_ /* = 0 */, std::optional<size_t> size_ /* = {} */) {
+	// When Texpected is set failures are returned as error codes instead of being thrown through the future
+	template<bool Texpected>
+	static auto map_async_impl(buffer& self, std::optional<bool> for_writing_, std::optional<size_t> offset_, std::optional<size_t> size_) {
+		using value_t = std::conditional_t<Texpected, result<std::byte*>, std::byte*>;
 		auto for_writing = for_writing_.value_or(false);
 		auto offset = offset_.value_or(0);
-		auto size = size_.value_or(this->size() - offset);
+		auto size = size_.value_or(self.size() - offset);
 		struct userdata {
-			std::promise<std::byte*> res;
+			std::promise<value_t> res;
 			buffer* self;
 			bool for_writing;
 			size_t offset, size;
 		};
-		userdata* data = new userdata{{}, this, for_writing, offset, size};
+		userdata* data = new userdata{{}, &self, for_writing, offset, size};
 		auto out = data->res.get_future();
 
-		auto future = wgpuBufferMapAsync(buffer_, for_writing ? WGPUMapMode_Write : WGPUMapMode_Read, offset, size, {
+		auto future = wgpuBufferMapAsync(self.buffer_, for_writing ? WGPUMapMode_Write : WGPUMapMode_Read, offset, size, {
 			.mode = WGPUCallbackMode_AllowSpontaneous,
 			.callback = [](WGPUMapAsyncStatus status, WGPUStringView message, void* userdata1, void*){
 				struct userdata* data = (struct userdata*)userdata1;
 				defer_ { delete data; };
-				try {
+				if constexpr (Texpected) {
+					switch (status) {
+					case WGPUMapAsyncStatus_CallbackCancelled: [[fallthrough]];
+					case WGPUMapAsyncStatus_Error: [[fallthrough]];
+					case WGPUMapAsyncStatus_Aborted:
+						STYLIZER_API_REPORT(stylizer::error_severity::Warning, from_webgpu(message), 0);
+						data->res.set_value(std::unexpected(error_code::MapFailed));
+					break; case WGPUMapAsyncStatus_Success: [[fallthrough]];
+					case WGPUMapAsyncStatus_Force32:
+						data->res.set_value(data->self->get_mapped_range(data->for_writing, data->offset, data->size));
+					}
+				} else try {
 					switch (status) {
 					case WGPUMapAsyncStatus_CallbackCancelled: [[fallthrough]];
 					case WGPUMapAsyncStatus_Error: [[fallthrough]];
@@ -137,15 +150,36 @@ namespace stylizer::api::webgpu {
 			}, .userdata1 = data, .userdata2 = nullptr
 		});
 
-		return out;
+		return std::pair{std::move(out), future};
+	}
+
+	std::future<std::byte*> buffer::map_async(api::device& device, std::optional<bool> for_writing /* = false */, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size /* = {} */) {
+		return map_async_impl<false>(*this, for_writing, offset, size).first;
 	}
 
 	std::byte* buffer::map(api::device& device, std::optional<bool> for_writing /* = false */, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size /* = {} */) {
-		auto future = map_async(device, for_writing, offset, size);
-		do {
-			confirm_webgpu_type<webgpu::device>(device).process_events();
-		} while(future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready);
+		auto [future, wgpu_future] = map_async_impl<false>(*this, for_writing, offset, size);
+		// NOTE: If the wait fails the callback hasn't run yet, so getting the future would block forever
+		if (!confirm_webgpu_type<webgpu::device>(device).wait(wgpu_future))
+			STYLIZER_API_THROW("Failed to map buffer: waiting for the mapping failed");
+		return future.get();
+	}
+
+	std::future<result<std::byte*>> buffer::try_map_async(api::device& device_, std::optional<bool> for_writing /* = false */, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size /* = {} */) {
+		if (confirm_webgpu_type<webgpu::device>(device_).is_lost()) {
+			std::promise<result<std::byte*>> lost;
+			lost.set_value(std::unexpected(error_code::DeviceLost));
+			return lost.get_future();
+		}
+		return map_async_impl<true>(*this, for_writing, offset, size).first;
+	}
 
+	result<std::byte*> buffer::try_map(api::device& device_, std::optional<bool> for_writing /* = false */, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size /* = {} */) {
+		auto& device = confirm_webgpu_type<webgpu::device>(device_);
+		if (device.is_lost()) return std::unexpected(error_code::DeviceLost);
+		auto [future, wgpu_future] = map_async_impl<true>(*this, for_writing, offset, size);
+		if (!device.wait(wgpu_future))
+			return std::unexpected(device.is_lost() ? error_code::DeviceLost : error_code::MapFailed);
 		return future.get();
 	}
 
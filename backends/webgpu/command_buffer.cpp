@@ -2,22 +2,22 @@
 
 namespace stylizer::api::webgpu {
 
-	void command_buffer::submit(api::device& device_, bool release /* = true */) {
+	result<uint64_t> command_buffer::try_submit(api::device& device_, bool release /* = true */) {
 		assert(*this); // Ensures there is at least one thing to submit!
 		auto& device = confirm_webgpu_type<webgpu::device>(device_);
-		std::vector<WGPUCommandBuffer> commands;
-		commands.reserve(3);
-		if (pre) commands.emplace_back(pre);
-		if (compute) commands.emplace_back(compute);
-		if (render) commands.emplace_back(render);
-		wgpuQueueSubmit(device.queue, commands.size(), commands.data());
+		auto serial = device.try_submit({&buffer, 1});
 		if (release) this->release();
+		return serial;
+	}
+
+	uint64_t command_buffer::submit(api::device& device, bool release /* = true */) {
+		auto serial = try_submit(device, release);
+		if (!serial) STYLIZER_API_THROW(error_message(serial.error()));
+		return *serial;
 	}
 
 	void command_buffer::release() {
-		if (pre) wgpuCommandBufferRelease(std::exchange(pre, nullptr));
-		if (compute) wgpuCommandBufferRelease(std::exchange(compute, nullptr));
-		if (render) wgpuCommandBufferRelease(std::exchange(render, nullptr));
+		if (buffer) wgpuCommandBufferRelease(std::exchange(buffer, nullptr));
 		deferred_to_release();
 	}
 
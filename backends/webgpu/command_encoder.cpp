@@ -12,28 +12,58 @@ namespace stylizer::api::webgpu {
 	}
 
 	template<typename Tapi_return, typename Twebgpu_return>
-	WGPUCommandEncoder command_encoder_base<Tapi_return, Twebgpu_return>::maybe_create_pre_encoder(webgpu::device& device) {
-		std::string label = this->label + " Pre Encoder";
-		WGPUCommandEncoderDescriptor d = {.label = label.c_str()};
-		if(!pre_encoder) pre_encoder = wgpuDeviceCreateCommandEncoder(device.device_, &d);
-		return pre_encoder;
+	WGPUCommandEncoder command_encoder_base<Tapi_return, Twebgpu_return>::maybe_create_encoder(webgpu::device& device) {
+		if(!encoder) {
+			auto label = this->label + " Encoder";
+			WGPUCommandEncoderDescriptor d = WGPU_COMMAND_ENCODER_DESCRIPTOR_INIT;
+			d.label = to_webgpu_label(label);
+			encoder = wgpuDeviceCreateCommandEncoder(device.device_, &d);
+		}
+		return encoder;
+	}
+
+	template<typename Tapi_return, typename Twebgpu_return>
+	WGPUCommandEncoder command_encoder_base<Tapi_return, Twebgpu_return>::maybe_end_passes(webgpu::device& device) {
+		end_compute_pass();
+		((Twebgpu_return*)this)->end_render_pass();
+		return maybe_create_encoder(device);
 	}
 
 	template<typename Tapi_return, typename Twebgpu_return>
 	WGPUComputePassEncoder command_encoder_base<Tapi_return, Twebgpu_return>::maybe_create_compute_pass(webgpu::device& device) {
-		if(!compute_encoder) {
-			std::string label = this->label + " Compute Encoder";
-			WGPUCommandEncoderDescriptor d{.label = label.c_str()};
-			compute_encoder = wgpuDeviceCreateCommandEncoder(device.device_, &d);
-		}
 		if(!compute_pass) {
-			std::string label = this->label + " Compute Pass";
-			WGPUComputePassDescriptor d{.label = label.c_str()};
-			compute_pass = wgpuCommandEncoderBeginComputePass(compute_encoder, &d);
+			((Twebgpu_return*)this)->end_render_pass();
+			auto label = this->label + " Compute Pass";
+			WGPUComputePassDescriptor d = WGPU_COMPUTE_PASS_DESCRIPTOR_INIT;
+			d.label = to_webgpu_label(label);
+			compute_pass = wgpuCommandEncoderBeginComputePass(maybe_create_encoder(device), &d);
 		}
 		return compute_pass;
 	}
 
+	template<typename Tapi_return, typename Twebgpu_return>
+	void command_encoder_base<Tapi_return, Twebgpu_return>::end_compute_pass() {
+		if(!compute_pass) return;
+		wgpuComputePassEncoderEnd(compute_pass);
+		wgpuComputePassEncoderRelease(std::exchange(compute_pass, nullptr));
+		bound.reset();
+	}
+
+	template<typename Tapi_return, typename Twebgpu_return>
+	command_buffer command_encoder_base<Tapi_return, Twebgpu_return>::finish() {
+		end_compute_pass();
+		((Twebgpu_return*)this)->end_render_pass();
+		command_buffer out;
+		if(encoder) {
+			WGPUCommandBufferDescriptor d = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
+			d.label = to_webgpu_label(label);
+			out.buffer = wgpuCommandEncoderFinish(encoder, &d);
+			wgpuCommandEncoderRelease(std::exchange(encoder, nullptr)); // A finished encoder can't record anything else
+		}
+		out.deferred_to_release = std::move(deferred_to_release);
+		return out;
+	}
+
 	// Defined in buffer.cpp
 	void copy_buffer_to_buffer_impl(WGPUCommandEncoder e, webgpu::buffer& destination, const webgpu::buffer& source, size_t destination_offset = 0, size_t source_offset = 0, std::optional<size_t> size_override = {});
 
@@ -47,7 +77,7 @@ namespace stylizer::api::webgpu {
 		size_t src_offset = source_offset.value_or(0);
 		size_t src_size = size_override.value_or(src.size() - src_offset);
 		assert(src_size <= dest_size);
-		copy_buffer_to_buffer_impl(maybe_create_pre_encoder(device), dest, src, dest_offset, src_offset, src_size);
+		copy_buffer_to_buffer_impl(maybe_end_passes(device), dest, src, dest_offset, src_offset, src_size);
 		return *(Tapi_return*)this;
 	}
 
@@ -69,7 +99,7 @@ namespace stylizer::api::webgpu {
 		auto src_mips = src.mip_levels() - min_mip;
 		if(!mip_levels_override.has_value()) assert(src_mips <= dest_mips);
 		else assert(mip_levels_override.value() <= src_mips && mip_levels_override.value() <= dest_mips);
-		copy_texture_to_texture_impl(maybe_create_pre_encoder(device), dest, src, destination_origin.value_or(vec3u{ 0, 0, 0 }), source_origin.value_or(vec3u{0, 0, 0}), src_extent, min_mip, mip_levels_override.value_or(src_mips));
+		copy_texture_to_texture_impl(maybe_end_passes(device), dest, src, destination_origin.value_or(vec3u{ 0, 0, 0 }), source_origin.value_or(vec3u{0, 0, 0}), src_extent, min_mip, mip_levels_override.value_or(src_mips));
 		return *(Tapi_return*)this;
 	}
 
@@ -78,8 +108,10 @@ namespace stylizer::api::webgpu {
 	template<typename Tapi_return, typename Twebgpu_return>
 	Tapi_return& command_encoder_base<Tapi_return, Twebgpu_return>::bind_compute_pipeline(api::device& device, const api::compute_pipeline& pipeline_, bool release_on_submit /* = false */) {
 		auto& pipeline = confirm_webgpu_type<webgpu::compute_pipeline>(pipeline_);
-		wgpuComputePassEncoderSetPipeline(maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device)), pipeline.pipeline);
-		if(release_on_submit) deferred_to_release->connect([pipeline = std::move(pipeline)]() mutable {
+		auto pass = maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device));
+		if(bound.update_pipeline(pipeline.pipeline, redundant_binds_skipped))
+			wgpuComputePassEncoderSetPipeline(pass, pipeline.pipeline);
+		if(release_on_submit) deferred_to_release.push([pipeline = std::move(pipeline)]() mutable {
 			pipeline.release();
 		});
 		return *(Tapi_return*)this;
@@ -88,8 +120,11 @@ namespace stylizer::api::webgpu {
 	template<typename Tapi_return, typename Twebgpu_return>
 	Tapi_return& command_encoder_base<Tapi_return, Twebgpu_return>::bind_compute_group(api::device& device, const api::bind_group& group_, std::optional<bool> release_on_submit /* = false */, std::optional<size_t> index_override /* = {} */) {
 		auto& group = confirm_webgpu_type<webgpu::bind_group>(group_);
-		wgpuComputePassEncoderSetBindGroup(maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device)), index_override.value_or(group.index), group.group, 0, nullptr);
-		if(release_on_submit) deferred_to_release->connect([group = std::move(group)]() mutable {
+		auto pass = maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device));
+		auto index = index_override.value_or(group.index);
+		if(bound.update_group(index, group.group, redundant_binds_skipped))
+			wgpuComputePassEncoderSetBindGroup(pass, index, group.group, 0, nullptr);
+		if(release_on_submit) deferred_to_release.push([group = std::move(group)]() mutable {
 			group.release();
 		});
 		return *(Tapi_return*)this;
@@ -101,34 +136,48 @@ namespace stylizer::api::webgpu {
 		return *(Tapi_return*)this;
 	}
 
+	template<typename Tapi_return, typename Twebgpu_return>
+	Tapi_return& command_encoder_base<Tapi_return, Twebgpu_return>::dispatch_workgroups_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset /* = 0 */) {
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(indirect_buffer);
+		assert(flags_set(buffer.usage(), usage::Indirect));
+		assert(offset % 4 == 0 && offset + 3 * sizeof(uint32_t) <= buffer.size());
+		wgpuComputePassEncoderDispatchWorkgroupsIndirect(maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device)), buffer.buffer_, offset);
+		return *(Tapi_return*)this;
+	}
+
+	template<typename Tapi_return, typename Twebgpu_return>
+	Tapi_return& command_encoder_base<Tapi_return, Twebgpu_return>::begin_compute_pass(api::device& device) {
+		end_compute_pass();
+		maybe_create_compute_pass(confirm_webgpu_type<webgpu::device>(device));
+		return *(Tapi_return*)this;
+	}
+
+	template<typename Tapi_return, typename Twebgpu_return>
+	Tapi_return& command_encoder_base<Tapi_return, Twebgpu_return>::end_pass(api::device& device) {
+		end_compute_pass();
+		((Twebgpu_return*)this)->end_render_pass();
+		return *(Tapi_return*)this;
+	}
+
 	template<typename Tapi_return, typename Twebgpu_return>
 	command_buffer command_encoder_base<Tapi_return, Twebgpu_return>::end(api::device& device) {
-		if(compute_pass) wgpuComputePassEncoderEnd(compute_pass);
-		command_buffer out;
-		WGPUCommandBufferDescriptor d = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
-		if(pre_encoder) out.pre = wgpuCommandEncoderFinish(pre_encoder, &d);
-		if(compute_encoder) out.compute = wgpuCommandEncoderFinish(compute_encoder, &d);
-		{ // TODO: Why does this have to be two steps?
-			auto& deferred = *deferred_to_release;
-			out.deferred_to_release = std::move(deferred);
-		}
-		return out;
+		return finish();
 	}
 
 	template<typename Tapi_return, typename Twebgpu_return>
-	void command_encoder_base<Tapi_return, Twebgpu_return>::one_shot_submit(api::device& device) {
+	uint64_t command_encoder_base<Tapi_return, Twebgpu_return>::one_shot_submit(api::device& device) {
 		assert(one_shot);
 		auto buffer = end(device);
-		buffer.submit(device, true);
+		auto serial = buffer.submit(device, true);
 		this->release();
+		return serial;
 	}
 
 	template<typename Tapi_return, typename Twebgpu_return>
 	void command_encoder_base<Tapi_return, Twebgpu_return>::release() {
-		if(pre_encoder) wgpuCommandEncoderRelease(std::exchange(pre_encoder, nullptr));
-		if(compute_encoder) wgpuCommandEncoderRelease(std::exchange(compute_encoder, nullptr));
 		if(compute_pass) wgpuComputePassEncoderRelease(std::exchange(compute_pass, nullptr));
-		(*deferred_to_release)();
+		if(encoder) wgpuCommandEncoderRelease(std::exchange(encoder, nullptr));
+		deferred_to_release();
 	}
 
 	static_assert(command_encoder_concept<command_encoder>);
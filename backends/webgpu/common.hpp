@@ -4,28 +4,44 @@
 #include "cstring_from_view.hpp"
 
 #include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace stylizer::api::webgpu {
 	// Implementation in device.cpp
 	WGPUInstance get_common_instance();
 
+	// Implementation in blob_cache.cpp
+	WGPUDawnCacheDeviceDescriptor create_blob_cache_descriptor(std::string_view directory);
+
 	inline WGPUStringView to_webgpu(std::string_view view) { return {view.data(), view.size()}; }
 	inline std::string_view from_webgpu(WGPUStringView view) { return {view.data, view.length}; }
 
+	// Debug labels are dropped entirely when STYLIZER_API_NO_LABELS is defined
+	inline WGPUStringView to_webgpu_label(std::string_view label) {
+#ifdef STYLIZER_API_NO_LABELS
+		return WGPU_STRING_VIEW_INIT;
+#else
+		return to_webgpu(label);
+#endif
+	}
+
 	inline WGPUCommandEncoder create_command_encoder(WGPUDevice device, std::string_view label = "Temporary Encode") {
 		WGPUCommandEncoderDescriptor d = WGPU_COMMAND_ENCODER_DESCRIPTOR_INIT;
-		d.label = to_webgpu(label);
+		d.label = to_webgpu_label(label);
 		return wgpuDeviceCreateCommandEncoder(device, &d);
 	}
 
-	inline void finish_and_submit(WGPUCommandEncoder e, WGPUQueue q) {
+	inline uint64_t finish_and_submit(WGPUCommandEncoder e, webgpu::device& device) {
 		WGPUCommandBufferDescriptor d = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
-		d.label = to_webgpu("Temporary");
+		d.label = to_webgpu_label("Temporary");
 		auto commands = wgpuCommandEncoderFinish(e, &d);
 		defer_ { wgpuCommandBufferRelease(commands); };
-		wgpuQueueSubmit(q, 1, &commands);
+		return device.submit({&commands, 1});
 	}
 
 	inline bool wait_for_future(WGPUFuture future, std::chrono::nanoseconds timeout = std::chrono::milliseconds(1)) {
@@ -48,15 +64,27 @@ namespace stylizer::api::webgpu {
 		return -1;
 	}
 
-	template<typename Tto, typename Tfrom>
+	// Objects which are lazily created and then reused for the lifetime of a device
+	struct device_caches {
+		std::mutex mutex; // Guards everything below
+		std::unordered_map<usage, std::map<size_t, stylizer::auto_release<webgpu::buffer>>> zero_buffers; // Keyed by size, entries are immutable once created
+		stylizer::auto_release<webgpu::shader> blit_shader;
+		std::unordered_map<texture_format, stylizer::auto_release<webgpu::render_pipeline>> blit_pipelines;
+		std::unordered_map<WGPUTextureFormat, stylizer::auto_release<webgpu::compute_pipeline>> mipmap_pipelines;
+	};
+
+	// RTTI free downcast. Passing an object from another backend is a static_cast to the wrong type and thus undefined
+	//  behaviour, the assert on the `type` tag (which every backend stores as the first member of its objects) is only
+	//  a best-effort debug check which happens to catch such mistakes in practice, it is not a guarantee.
+	template<typename Tto, typename Tfrom> requires(std::derived_from<Tto, Tfrom>)
 	inline Tto& confirm_webgpu_type(Tfrom& ref) {
-		auto& res = ref.template as<Tto>();
+		auto& res = static_cast<Tto&>(ref);
 		assert(res.type == magic_number);
 		return res;
 	}
-	template<typename Tto, typename Tfrom>
+	template<typename Tto, typename Tfrom> requires(std::derived_from<Tto, Tfrom>)
 	inline const Tto& confirm_webgpu_type(const Tfrom& ref) {
-		auto& res = const_cast<Tfrom&>(ref).template as<Tto>();
+		auto& res = static_cast<const Tto&>(ref);
 		assert(res.type == magic_number);
 		return res;
 	}
@@ -66,7 +94,8 @@ namespace stylizer::api::webgpu {
 
 	inline WGPUOptionalBool to_webgpu(bool v) { return v ? WGPUOptionalBool_True : WGPUOptionalBool_False; }
 
-	inline usage from_webgpu_texture(WGPUTextureUsage usage) {
+	// Returns nothing (instead of throwing) when none of the usages are known
+	inline std::optional<usage> try_from_webgpu_texture(WGPUTextureUsage usage) {
 		enum usage out = usage::Invalid;
 		if(flags_set(usage, WGPUTextureUsage_CopySrc)) out |= usage::CopySource;
 		if(flags_set(usage, WGPUTextureUsage_CopyDst)) out |= usage::CopyDestination;
@@ -75,9 +104,14 @@ namespace stylizer::api::webgpu {
 		if(flags_set(usage, WGPUTextureUsage_RenderAttachment)) out |= usage::RenderAttachment;
 		if(flags_set(usage, WGPUTextureUsage_TransientAttachment)) out |= usage::TransientAttachment;
 		if(flags_set(usage, WGPUTextureUsage_StorageAttachment)) out |= usage::StorageAttachment;
-		if(out == usage::Invalid) STYLIZER_API_THROW(std::string("Failed to find texture usage: ") + std::to_string(usage));
+		if(out == usage::Invalid) return {};
 		return out;
 	}
+	inline usage from_webgpu_texture(WGPUTextureUsage usage) {
+		auto out = try_from_webgpu_texture(usage);
+		if(!out) STYLIZER_API_THROW(std::string("Failed to find texture usage: ") + std::to_string(usage));
+		return *out;
+	}
 
 	inline WGPUTextureUsage to_webgpu_texture(usage usage) {
 		WGPUTextureUsage out = 0;
@@ -124,7 +158,8 @@ namespace stylizer::api::webgpu {
 		std::unreachable();
 	}
 
-	inline texture_format from_webgpu(WGPUTextureFormat format) {
+	// Returns nothing (instead of throwing) for formats which have no equivalent
+	inline std::optional<texture_format> try_from_webgpu(WGPUTextureFormat format) {
 		switch(format) {
 		case WGPUTextureFormat_Undefined: return texture_format::Undefined;
 		case WGPUTextureFormat_R8Unorm: return texture_format::Ru8_Normalized;
@@ -235,10 +270,14 @@ namespace stylizer::api::webgpu {
 		case WGPUTextureFormat_R8BG8Biplanar444Unorm: return texture_format::R8BG8Biplanar444_Normalized;
 		case WGPUTextureFormat_R10X6BG10X6Biplanar422Unorm: return texture_format::R10X6BG10X6Biplanar422_Normalized;
 		case WGPUTextureFormat_R10X6BG10X6Biplanar444Unorm: return texture_format::R10X6BG10X6Biplanar444_Normalized;
-		default:
-			STYLIZER_API_THROW(std::string("Failed to find texture format: ") + std::string(magic_enum::enum_name(format)));
+		default: return {};
 		}
 	}
+	inline texture_format from_webgpu(WGPUTextureFormat format) {
+		auto out = try_from_webgpu(format);
+		if(!out) STYLIZER_API_THROW(std::string("Failed to find texture format: ") + std::string(magic_enum::enum_name(format)));
+		return *out;
+	}
 
 	inline WGPUTextureFormat to_webgpu(texture_format format) {
 		switch(format) {
@@ -45,7 +45,7 @@ namespace stylizer::api::webgpu {
 		bind_group out;
 		out.index = index;
 		WGPUBindGroupDescriptor d = WGPU_BIND_GROUP_DESCRIPTOR_INIT;
-		d.label = to_webgpu(label);
+		d.label = to_webgpu_label(label);
 		d.layout = layout,
 		d.entryCount = entries.size(),
 		d.entries = entries.data(),
@@ -60,7 +60,7 @@ namespace stylizer::api::webgpu {
 
 		compute_pipeline out;
 		WGPUComputePipelineDescriptor d = WGPU_COMPUTE_PIPELINE_DESCRIPTOR_INIT;
-		d.label = to_webgpu(label);
+		d.label = to_webgpu_label(label);
 		d.compute = {
 			.module = shader.module,
 			.entryPoint = to_webgpu(entry_point.entry_point_name)
@@ -74,8 +74,7 @@ namespace stylizer::api::webgpu {
 		return internal_bind_group_create(device, index, wgpuComputePipelineGetBindGroupLayout(pipeline, index), bindings, label);
 	}
 	api::bind_group& compute_pipeline::create_bind_group(temporary_return_t, api::device& device, size_t index, std::span<const bind_group::binding> bindings, std::string_view label /* = "Stylizer Bind Group" */) {
-		static webgpu::bind_group group;
-		return group = create_bind_group(device, index, bindings, label);
+		return temporary_storage(create_bind_group(device, index, bindings, label));
 	}
 
 	void compute_pipeline::release() {
@@ -1,5 +1,10 @@
 #include "common.hpp"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace stylizer::api::webgpu {
 	WGPUInstance get_common_instance() {
 		static struct Singleton {
@@ -12,10 +17,7 @@ namespace stylizer::api::webgpu {
 			d.requiredFeatureCount = features.size();
 			d.requiredFeatures = features.data();
 
-			WGPUDawnTogglesDescriptor toggles;
-			toggles.chain.next = nullptr;
-			toggles.chain.sType = WGPUSType_DawnTogglesDescriptor;
-			toggles.disabledToggleCount = 0;
+			WGPUDawnTogglesDescriptor toggles = WGPU_DAWN_TOGGLES_DESCRIPTOR_INIT;
 			std::array<const char*, 1> enabledToggles = {"enable_immediate_error_handling"};
 			toggles.enabledToggleCount = enabledToggles.size();
 			toggles.enabledToggles = enabledToggles.data();
@@ -26,13 +28,133 @@ namespace stylizer::api::webgpu {
 		return singleton.instance;
 	}
 
-	webgpu::device device::create_default(const webgpu::device::create_config& config /* = {} */) {
-		device out;
+	struct profile_toggles {
+		std::span<const char* const> enabled;
+		std::span<const char* const> disabled;
+	};
+
+	// NOTE: Toggles enabled on the instance (see get_common_instance) are inherited by every device unless disabled here
+	static std::optional<profile_toggles> toggles_for(enum device::performance_profile profile) {
+		switch (profile) {
+		case device::performance_profile::Debug: {
+			constexpr static std::array<const char*, 2> enabled = {"use_user_defined_labels_in_backend", "disable_symbol_renaming"};
+			return profile_toggles{enabled, {}};
+		}
+		case device::performance_profile::Balanced:
+			return profile_toggles{};
+		case device::performance_profile::Throughput: {
+			constexpr static std::array<const char*, 2> enabled = {"skip_validation", "disable_robustness"};
+			constexpr static std::array<const char*, 2> disabled = {"lazy_clear_resource_on_first_use", "enable_immediate_error_handling"};
+			return profile_toggles{enabled, disabled};
+		}
+		default: return {}; // Unknown profile
+		}
+	}
+
+	static WGPULimits to_webgpu(const device_limits& limits) {
+		constexpr auto u32 = [](uint32_t v) { return v ? v : WGPU_LIMIT_U32_UNDEFINED; };
+		constexpr auto u64 = [](uint64_t v) { return v ? v : WGPU_LIMIT_U64_UNDEFINED; };
+		WGPULimits out = WGPU_LIMITS_INIT;
+		out.maxTextureDimension1D = u32(limits.max_texture_dimension_1D);
+		out.maxTextureDimension2D = u32(limits.max_texture_dimension_2D);
+		out.maxTextureDimension3D = u32(limits.max_texture_dimension_3D);
+		out.maxTextureArrayLayers = u32(limits.max_texture_array_layers);
+		out.maxBindGroups = u32(limits.max_bind_groups);
+		out.maxBindGroupsPlusVertexBuffers = u32(limits.max_bind_groups_plus_vertex_buffers);
+		out.maxBindingsPerBindGroup = u32(limits.max_bindings_per_bind_group);
+		out.maxDynamicUniformBuffersPerPipelineLayout = u32(limits.max_dynamic_uniform_buffers_per_pipeline_layout);
+		out.maxDynamicStorageBuffersPerPipelineLayout = u32(limits.max_dynamic_storage_buffers_per_pipeline_layout);
+		out.maxSampledTexturesPerShaderStage = u32(limits.max_sampled_textures_per_shader_stage);
+		out.maxSamplersPerShaderStage = u32(limits.max_samplers_per_shader_stage);
+		out.maxStorageBuffersPerShaderStage = u32(limits.max_storage_buffers_per_shader_stage);
+		out.maxStorageTexturesPerShaderStage = u32(limits.max_storage_textures_per_shader_stage);
+		out.maxUniformBuffersPerShaderStage = u32(limits.max_uniform_buffers_per_shader_stage);
+		out.maxUniformBufferBindingSize = u64(limits.max_uniform_buffer_binding_size);
+		out.maxStorageBufferBindingSize = u64(limits.max_storage_buffer_binding_size);
+		out.minUniformBufferOffsetAlignment = u32(limits.min_uniform_buffer_offset_alignment);
+		out.minStorageBufferOffsetAlignment = u32(limits.min_storage_buffer_offset_alignment);
+		out.maxVertexBuffers = u32(limits.max_vertex_buffers);
+		out.maxBufferSize = u64(limits.max_buffer_size);
+		out.maxVertexAttributes = u32(limits.max_vertex_attributes);
+		out.maxVertexBufferArrayStride = u32(limits.max_vertex_buffer_array_stride);
+		out.maxInterStageShaderVariables = u32(limits.max_inter_stage_shader_variables);
+		out.maxColorAttachments = u32(limits.max_color_attachments);
+		out.maxColorAttachmentBytesPerSample = u32(limits.max_color_attachment_bytes_per_sample);
+		out.maxComputeWorkgroupStorageSize = u32(limits.max_compute_workgroup_storage_size);
+		out.maxComputeInvocationsPerWorkgroup = u32(limits.max_compute_invocations_per_workgroup);
+		out.maxComputeWorkgroupSizeX = u32(limits.max_compute_workgroup_size_x);
+		out.maxComputeWorkgroupSizeY = u32(limits.max_compute_workgroup_size_y);
+		out.maxComputeWorkgroupSizeZ = u32(limits.max_compute_workgroup_size_z);
+		out.maxComputeWorkgroupsPerDimension = u32(limits.max_compute_workgroups_per_dimension);
+		return out;
+	}
+
+	static device_limits from_webgpu(const WGPULimits& limits) {
+		device_limits out;
+		out.max_texture_dimension_1D = limits.maxTextureDimension1D;
+		out.max_texture_dimension_2D = limits.maxTextureDimension2D;
+		out.max_texture_dimension_3D = limits.maxTextureDimension3D;
+		out.max_texture_array_layers = limits.maxTextureArrayLayers;
+		out.max_bind_groups = limits.maxBindGroups;
+		out.max_bind_groups_plus_vertex_buffers = limits.maxBindGroupsPlusVertexBuffers;
+		out.max_bindings_per_bind_group = limits.maxBindingsPerBindGroup;
+		out.max_dynamic_uniform_buffers_per_pipeline_layout = limits.maxDynamicUniformBuffersPerPipelineLayout;
+		out.max_dynamic_storage_buffers_per_pipeline_layout = limits.maxDynamicStorageBuffersPerPipelineLayout;
+		out.max_sampled_textures_per_shader_stage = limits.maxSampledTexturesPerShaderStage;
+		out.max_samplers_per_shader_stage = limits.maxSamplersPerShaderStage;
+		out.max_storage_buffers_per_shader_stage = limits.maxStorageBuffersPerShaderStage;
+		out.max_storage_textures_per_shader_stage = limits.maxStorageTexturesPerShaderStage;
+		out.max_uniform_buffers_per_shader_stage = limits.maxUniformBuffersPerShaderStage;
+		out.max_uniform_buffer_binding_size = limits.maxUniformBufferBindingSize;
+		out.max_storage_buffer_binding_size = limits.maxStorageBufferBindingSize;
+		out.min_uniform_buffer_offset_alignment = limits.minUniformBufferOffsetAlignment;
+		out.min_storage_buffer_offset_alignment = limits.minStorageBufferOffsetAlignment;
+		out.max_vertex_buffers = limits.maxVertexBuffers;
+		out.max_buffer_size = limits.maxBufferSize;
+		out.max_vertex_attributes = limits.maxVertexAttributes;
+		out.max_vertex_buffer_array_stride = limits.maxVertexBufferArrayStride;
+		out.max_inter_stage_shader_variables = limits.maxInterStageShaderVariables;
+		out.max_color_attachments = limits.maxColorAttachments;
+		out.max_color_attachment_bytes_per_sample = limits.maxColorAttachmentBytesPerSample;
+		out.max_compute_workgroup_storage_size = limits.maxComputeWorkgroupStorageSize;
+		out.max_compute_invocations_per_workgroup = limits.maxComputeInvocationsPerWorkgroup;
+		out.max_compute_workgroup_size_x = limits.maxComputeWorkgroupSizeX;
+		out.max_compute_workgroup_size_y = limits.maxComputeWorkgroupSizeY;
+		out.max_compute_workgroup_size_z = limits.maxComputeWorkgroupSizeZ;
+		out.max_compute_workgroups_per_dimension = limits.maxComputeWorkgroupsPerDimension;
+		return out;
+	}
+
+	// Returns nothing for features without a WebGPU equivalent
+	static std::optional<WGPUFeatureName> to_webgpu(enum feature feature) {
+		switch (feature) {
+		case feature::Float32Filterable: return WGPUFeatureName_Float32Filterable;
+		case feature::ShaderF16: return WGPUFeatureName_ShaderF16;
+		case feature::Subgroups: return WGPUFeatureName_Subgroups;
+		case feature::TimestampQuery: return WGPUFeatureName_TimestampQuery;
+		case feature::IndirectFirstInstance: return WGPUFeatureName_IndirectFirstInstance;
+		case feature::DepthClipControl: return WGPUFeatureName_DepthClipControl;
+		case feature::DualSourceBlending: return WGPUFeatureName_DualSourceBlending;
+		case feature::TextureCompressionBC: return WGPUFeatureName_TextureCompressionBC;
+		default: return {};
+		}
+	}
+
+	static enum adapter_type adapter_type_of(const WGPUAdapterInfo& info) {
+		if (info.backendType == WGPUBackendType_Null) return adapter_type::Null;
+		if (info.adapterType == WGPUAdapterType_CPU) return adapter_type::Software;
+		return adapter_type::Hardware;
+	}
 
+	static WGPUAdapter request_adapter(const webgpu::device::create_config& config, enum adapter_type type) {
 		WGPURequestAdapterOptions options = WGPU_REQUEST_ADAPTER_OPTIONS_INIT;
 		options.featureLevel = WGPUFeatureLevel_Core;
 		options.powerPreference = config.high_performance ? WGPUPowerPreference_HighPerformance : WGPUPowerPreference_LowPower;
-		options.compatibleSurface = config.compatible_surface ? confirm_webgpu_type<webgpu::surface>(*config.compatible_surface).surface_ : nullptr;
+		options.forceFallbackAdapter = type == adapter_type::Software;
+		if (type == adapter_type::Null) options.backendType = WGPUBackendType_Null;
+		else options.compatibleSurface = config.compatible_surface ? confirm_webgpu_type<webgpu::surface>(*config.compatible_surface).surface_ : nullptr;
+
+		WGPUAdapter out = nullptr;
 		wait_for_future(wgpuInstanceRequestAdapter(get_common_instance(), &options, {
 			.mode = WGPUCallbackMode_AllowSpontaneous,
 			.callback = [](WGPURequestAdapterStatus status, WGPUAdapter adapter, WGPUStringView message, void* userdata, void*){
@@ -41,57 +163,213 @@ namespace stylizer::api::webgpu {
 				case WGPURequestAdapterStatus_CallbackCancelled: [[fallthrough]];
 				case WGPURequestAdapterStatus_Unavailable: [[fallthrough]];
 				case WGPURequestAdapterStatus_Error:
-					STYLIZER_API_THROW(from_webgpu(message));
-					[[fallthrough]];
-				case WGPURequestAdapterStatus_Success: [[fallthrough]];
+					// Not fatal, the next adapter in the preference list will be tried
+					STYLIZER_API_REPORT(stylizer::error_severity::Info, from_webgpu(message), 0);
+				break; case WGPURequestAdapterStatus_Success: [[fallthrough]];
 				case WGPURequestAdapterStatus_Force32:
 					out = adapter;
-				 break;
 				}
 			},
-			.userdata1 = &out.adapter, .userdata2 = nullptr
-		}));
+			.userdata1 = &out, .userdata2 = nullptr
+		}), std::chrono::nanoseconds::max()); // NOTE: The callback writes to the stack so we can't give up early
+		if (!out) return nullptr;
+
+		// Dawn will happily hand out a CPU adapter when asked for a GPU... make sure we got what we asked for
+		// NOTE: An adapter whose type can't be queried is treated as a mismatch
+		WGPUAdapterInfo info = WGPU_ADAPTER_INFO_INIT;
+		if (wgpuAdapterGetInfo(out, &info) != WGPUStatus_Success) {
+			wgpuAdapterRelease(out);
+			return nullptr;
+		}
+		defer_ { wgpuAdapterInfoFreeMembers(info); };
+		if (adapter_type_of(info) != type) {
+			wgpuAdapterRelease(out);
+			return nullptr;
+		}
+		return out;
+	}
+
+	struct submission_tracker {
+		// Keeps serials in the same order as the submissions they represent
+		// NOTE: Recursive since spontaneous callbacks (which may submit) can fire from inside wgpuQueueSubmit
+		std::recursive_mutex submit_mutex;
+		uint64_t last_submitted = 0;
+		std::atomic<uint64_t> completed = 0;
+		std::atomic<bool> lost = false;
+
+		std::mutex mutex; // Guards everything below
+		std::map<uint64_t, WGPUFuture> pending;
+		std::multimap<uint64_t, std::function<void()>> callbacks;
+
+		void complete(uint64_t serial) {
+			std::vector<std::function<void()>> ready;
+			{
+				std::scoped_lock lock(mutex);
+				// Work done callbacks fire in submission order, but be defensive about going backwards
+				if (serial > completed) completed = serial;
+				pending.erase(pending.begin(), pending.upper_bound(serial));
+				auto end = callbacks.upper_bound(serial);
+				for (auto i = callbacks.begin(); i != end; ++i)
+					ready.emplace_back(std::move(i->second));
+				callbacks.erase(callbacks.begin(), end);
+			}
+			for (auto& callback : ready) callback(); // Called outside the lock so callbacks may submit or register more callbacks
+		}
+	};
+
+	result<webgpu::device> device::try_create_default(const webgpu::device::create_config& config /* = {} */) {
+		device out;
+		defer_ { if (!out.device_) out.release(); }; // Don't leak the adapter if we fail
+
+		for (auto type : config.adapter_preference)
+			if ((out.adapter = request_adapter(config, type)))
+				break;
+		if (!out.adapter) return std::unexpected(error_code::NoAdapter);
+
+		// NOTE: Purely informational, so failing to query the adapter doesn't fail device creation
+		if (error_reporting_enabled(stylizer::error_severity::Info)) {
+			if (auto info = out.try_get_adapter_info())
+				get_error_handler()(stylizer::error_severity::Info, "Selected " + std::string(magic_enum::enum_name(info->adapter_type)) + " adapter: " + info->name + " (" + info->backend + ")", 0);
+			else STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to query the selected adapter's info", 0);
+		}
+
+		auto profile = toggles_for(config.performance_profile);
+		if (!profile) {
+			STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to find performance profile: " + std::string(magic_enum::enum_name(config.performance_profile)), 0);
+			return std::unexpected(error_code::DeviceCreationFailed);
+		}
+		WGPUDawnTogglesDescriptor toggles = WGPU_DAWN_TOGGLES_DESCRIPTOR_INIT;
+		toggles.enabledToggleCount = profile->enabled.size();
+		toggles.enabledToggles = profile->enabled.data();
+		toggles.disabledToggleCount = profile->disabled.size();
+		toggles.disabledToggles = profile->disabled.data();
+
+		WGPUDawnCacheDeviceDescriptor cache = WGPU_DAWN_CACHE_DEVICE_DESCRIPTOR_INIT;
+		if (!config.cache_directory.empty()) {
+			cache = create_blob_cache_descriptor(config.cache_directory);
+			toggles.chain.next = &cache.chain;
+		}
+
+		WGPULimits limits = WGPU_LIMITS_INIT;
+		if (config.request_best_limits) {
+			if (wgpuAdapterGetLimits(out.adapter, &limits) != WGPUStatus_Success)
+				return std::unexpected(error_code::AdapterQueryFailed);
+			limits.nextInChain = nullptr;
+		} else limits = to_webgpu(config.required_limits);
+
+		std::vector<WGPUFeatureName> features;
+		for (size_t bit = 0; bit < sizeof(enum feature) * 8; ++bit) {
+			auto feature = (enum feature)(1 << bit);
+			bool required = flags_set(config.required_features, feature);
+			if (!required && !flags_set(config.preferred_features, feature)) continue;
+
+			auto name = to_webgpu(feature);
+			if (!name || !wgpuAdapterHasFeature(out.adapter, *name)) {
+				if (!required) continue;
+				STYLIZER_API_REPORT(stylizer::error_severity::Warning, "The selected adapter doesn't support the required feature: " + std::string(magic_enum::enum_name(feature)), 0);
+				return std::unexpected(error_code::MissingFeature);
+			}
+			features.emplace_back(*name);
+			out.enabled_features |= feature;
+		}
 
-		WGPUFeatureName float32filterable = WGPUFeatureName_Float32Filterable;
+		out.submissions = std::make_shared<submission_tracker>();
 		WGPUDeviceDescriptor device = WGPU_DEVICE_DESCRIPTOR_INIT;
-		device.label = to_webgpu(config.label);
-		device.requiredFeatureCount = 1,
-		device.requiredFeatures = &float32filterable,
-		device.requiredLimits = nullptr,
-		device.defaultQueue = { .label = to_webgpu(config.queue_label) },
+		device.nextInChain = &toggles.chain;
+		device.label = to_webgpu_label(config.label);
+		device.requiredFeatureCount = features.size(),
+		device.requiredFeatures = features.data(),
+		device.requiredLimits = &limits,
+		device.defaultQueue = { .label = to_webgpu_label(config.queue_label) },
 		device.uncapturedErrorCallbackInfo = {
 			.callback = [](WGPUDevice const * device, WGPUErrorType type, WGPUStringView message, void* userdata1, void* userdata2) {
-				get_error_handler()(stylizer::error_severity::Error, from_webgpu(message), (size_t)type);
+				STYLIZER_API_REPORT(stylizer::error_severity::Error, from_webgpu(message), (size_t)type);
 			}
 		};
 		device.deviceLostCallbackInfo = {
 			.mode = WGPUCallbackMode_AllowSpontaneous,
 			.callback = [](WGPUDevice const * device, WGPUDeviceLostReason reason, WGPUStringView message, void* userdata1, void* userdata2) {
-				if (reason == WGPUDeviceLostReason_Destroyed) return;
-				STYLIZER_API_THROW(from_webgpu(message));
-			}
+				auto tracker = (std::shared_ptr<submission_tracker>*)userdata1;
+				defer_ { delete tracker; }; // Dawn calls this exactly once
+				if (reason == WGPUDeviceLostReason_Destroyed || reason == WGPUDeviceLostReason_CallbackCancelled || reason == WGPUDeviceLostReason_FailedCreation)
+					return; // Nothing was lost (creation failures are reported by the request below)
+
+				// NOTE: Throwing through Dawn isn't safe, instead the loss is recorded and surfaced by is_lost() and the try_ variants
+				(*tracker)->lost = true;
+				STYLIZER_API_REPORT(stylizer::error_severity::Error, "Device lost: " + std::string(from_webgpu(message)), 0);
+			},
+			.userdata1 = new std::shared_ptr<submission_tracker>(out.submissions), .userdata2 = nullptr
 		};
+		struct request_state {
+			WGPUDevice device = nullptr;
+			std::string message;
+		} request;
 		wait_for_future(wgpuAdapterRequestDevice(out.adapter, &device, {
 			.mode = WGPUCallbackMode_AllowSpontaneous,
 			.callback = [](WGPURequestDeviceStatus status, WGPUDevice device, WGPUStringView message, void* userdata, void*){
-				WGPUDevice& out = *(WGPUDevice*)userdata;
+				auto& out = *(request_state*)userdata;
 				switch (status) {
 				case WGPURequestDeviceStatus_CallbackCancelled: [[fallthrough]];
 				case WGPURequestDeviceStatus_Error:
-					STYLIZER_API_THROW(from_webgpu(message));
-					[[fallthrough]];
-				case WGPURequestDeviceStatus_Success: [[fallthrough]];
+					out.message = from_webgpu(message); // Thrown once we are back out of Dawn
+				break; case WGPURequestDeviceStatus_Success: [[fallthrough]];
 				case WGPURequestDeviceStatus_Force32:
-					out = device;
+					out.device = device;
 				}
 			},
-			.userdata1 = &out.device_, .userdata2 = nullptr
-		}));
+			.userdata1 = &request, .userdata2 = nullptr
+		}), std::chrono::nanoseconds::max()); // NOTE: The callback writes to the stack so we can't give up early
+		if (!request.device) {
+			STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Failed to create device: " + request.message, 0);
+			return std::unexpected(error_code::DeviceCreationFailed);
+		}
+		out.device_ = request.device;
 
 		out.queue = wgpuDeviceGetQueue(out.device_);
+		out.caches = std::make_shared<device_caches>();
+		out.objects = std::make_shared<object_registry>();
+		out.wait_strategy = config.wait_strategy;
+		out.wait_spin_duration = config.wait_spin_duration;
+		out.wait_sleep_interval = config.wait_sleep_interval;
 		return out;
 	}
 
+	webgpu::device device::create_default(const webgpu::device::create_config& config /* = {} */) {
+		auto out = try_create_default(config);
+		if (!out) STYLIZER_API_THROW(error_message(out.error()));
+		return std::move(*out);
+	}
+
+	std::future<webgpu::device> device::create_default_async(const webgpu::device::create_config& config /* = {} */) {
+		// The config only views its strings and adapter preference, so the worker thread gets owned copies of them
+		struct owned_config {
+			std::string label, queue_label, cache_directory;
+			std::vector<adapter_type> adapter_preference;
+		} owned = {
+			std::string(config.label), std::string(config.queue_label), std::string(config.cache_directory),
+			{config.adapter_preference.begin(), config.adapter_preference.end()},
+		};
+
+		return std::async(std::launch::async, [config, owned = std::move(owned)] {
+			return create_default({
+				.label = owned.label,
+				.queue_label = owned.queue_label,
+				.high_performance = config.high_performance,
+				.compatible_surface = config.compatible_surface,
+				.adapter_preference = owned.adapter_preference,
+				.performance_profile = config.performance_profile,
+				.request_best_limits = config.request_best_limits,
+				.required_limits = config.required_limits,
+				.cache_directory = owned.cache_directory,
+				.wait_strategy = config.wait_strategy,
+				.wait_spin_duration = config.wait_spin_duration,
+				.wait_sleep_interval = config.wait_sleep_interval,
+				.required_features = config.required_features,
+				.preferred_features = config.preferred_features,
+			});
+		});
+	}
+
 	bool device::process_events() {
 #ifdef WEBGPU_BACKEND_EMSCRIPTEN
 		emscripten_sleep(1);
@@ -101,37 +379,165 @@ namespace stylizer::api::webgpu {
 		return true;
 	}
 
-	bool device::tick(bool for_queues /* = true */) {
-		if (!for_queues) return process_events();
-
-		bool done = false;
-		wgpuQueueOnSubmittedWorkDone(queue, {
-			.mode = WGPUCallbackMode_AllowProcessEvents,
-			.callback = [](WGPUQueueWorkDoneStatus status, WGPUStringView message, WGPU_NULLABLE void* userdata, WGPU_NULLABLE void*){
-				bool& done = *(bool*)userdata;
-				switch(status){
-				case WGPUQueueWorkDoneStatus_CallbackCancelled: [[fallthrough]];
-				case WGPUQueueWorkDoneStatus_Error:
-					STYLIZER_API_THROW("Queue submit failed!");
-				break; case WGPUQueueWorkDoneStatus_Success:
-				case WGPUQueueWorkDoneStatus_Force32:
-					done = true;
-				
-				}
-			}, .userdata1 = &done, .userdata2 = nullptr
-		});
-		while(!done) process_events();
-		wgpuQueueOnSubmittedWorkDone(queue, {.callback = nullptr, .userdata1 = nullptr, .userdata2 = nullptr}); // Clear the callback
+	adapter_info device::get_adapter_info() const {
+		auto out = try_get_adapter_info();
+		if (!out) STYLIZER_API_THROW("Failed to query adapter info!");
+		return std::move(*out);
+	}
+
+	result<adapter_info> device::try_get_adapter_info() const {
+		WGPUAdapterInfo info = WGPU_ADAPTER_INFO_INIT;
+		if (wgpuAdapterGetInfo(adapter, &info) != WGPUStatus_Success)
+			return std::unexpected(error_code::AdapterQueryFailed);
+		defer_ { wgpuAdapterInfoFreeMembers(info); };
+
+		adapter_info out;
+		out.adapter_type = adapter_type_of(info);
+		out.vendor = from_webgpu(info.vendor);
+		out.architecture = from_webgpu(info.architecture);
+		out.name = from_webgpu(info.device);
+		out.description = from_webgpu(info.description);
+		switch (info.backendType) {
+		break; case WGPUBackendType_Null: out.backend = "Null";
+		break; case WGPUBackendType_WebGPU: out.backend = "WebGPU";
+		break; case WGPUBackendType_D3D11: out.backend = "D3D11";
+		break; case WGPUBackendType_D3D12: out.backend = "D3D12";
+		break; case WGPUBackendType_Metal: out.backend = "Metal";
+		break; case WGPUBackendType_Vulkan: out.backend = "Vulkan";
+		break; case WGPUBackendType_OpenGL: out.backend = "OpenGL";
+		break; case WGPUBackendType_OpenGLES: out.backend = "OpenGLES";
+		break; default: out.backend = "Unknown";
+		}
+		return out;
+	}
+
+	device_limits device::limits() const {
+		WGPULimits limits = WGPU_LIMITS_INIT;
+		if (wgpuDeviceGetLimits(device_, &limits) != WGPUStatus_Success)
+			STYLIZER_API_THROW("Failed to query device limits!");
+		return from_webgpu(limits);
+	}
+
+	bool device::poll() {
+#ifndef WEBGPU_BACKEND_EMSCRIPTEN // The browser processes events for us
+		wgpuInstanceProcessEvents(get_common_instance());
+		wgpuDeviceTick(device_);
+#endif
 		return true;
 	}
 
+	bool device::tick(bool for_queues /* = true */, std::optional<std::chrono::nanoseconds> timeout /* = {} */) {
+		if (!for_queues) return poll();
+
+		// NOTE: Completion is observed through the wait rather than the callback, so nothing on the stack can be left dangling if the wait times out
+		auto future = wgpuQueueOnSubmittedWorkDone(queue, {
+			.mode = WGPUCallbackMode_WaitAnyOnly,
+			.callback = [](WGPUQueueWorkDoneStatus status, WGPUStringView message, WGPU_NULLABLE void*, WGPU_NULLABLE void*){
+				if (status != WGPUQueueWorkDoneStatus_Success)
+					STYLIZER_API_REPORT(stylizer::error_severity::Error, "Queue submit failed: " + std::string(from_webgpu(message)), 0);
+			}, .userdata1 = nullptr, .userdata2 = nullptr
+		});
+		return wait(future, timeout);
+	}
+
+	bool device::wait(WGPUFuture future, std::optional<std::chrono::nanoseconds> timeout /* = {} */) {
+		WGPUFutureWaitInfo info = WGPU_FUTURE_WAIT_INFO_INIT;
+		info.future = future;
+		auto instance = get_common_instance();
+
+		if (wait_strategy == wait_strategy::Block) {
+			auto status = wgpuInstanceWaitAny(instance, 1, &info, timeout ? std::max<int64_t>(timeout->count(), 0) : UINT64_MAX);
+			return status == WGPUWaitStatus_Success && info.completed;
+		}
+
+		using clock = std::chrono::steady_clock;
+		auto start = clock::now();
+		auto deadline = timeout && *timeout < clock::time_point::max() - start ? start + *timeout : clock::time_point::max();
+		while (true) {
+			if (wgpuInstanceWaitAny(instance, 1, &info, 0) == WGPUWaitStatus_Success && info.completed)
+				return true;
+
+			auto now = clock::now();
+			if (now >= deadline) return false;
+			if (now - start >= wait_spin_duration)
+				std::this_thread::sleep_for(std::min<clock::duration>(wait_sleep_interval, deadline - now));
+		}
+	}
+
+	result<uint64_t> device::try_submit(std::span<const WGPUCommandBuffer> commands) {
+		if (is_lost()) return std::unexpected(error_code::DeviceLost);
+		std::scoped_lock submit_lock(submissions->submit_mutex);
+		wgpuQueueSubmit(queue, commands.size(), commands.data());
+		auto serial = ++submissions->last_submitted;
+
+		using userdata = std::shared_ptr<submission_tracker>;
+		auto future = wgpuQueueOnSubmittedWorkDone(queue, {
+			.mode = WGPUCallbackMode_AllowSpontaneous,
+			.callback = [](WGPUQueueWorkDoneStatus status, WGPUStringView message, WGPU_NULLABLE void* userdata1, WGPU_NULLABLE void* userdata2){
+				auto tracker = (userdata*)userdata1;
+				defer_ { delete tracker; };
+				if (status == WGPUQueueWorkDoneStatus_Error)
+					STYLIZER_API_REPORT(stylizer::error_severity::Error, "Queue submit failed: " + std::string(from_webgpu(message)), 0);
+				(*tracker)->complete((uint64_t)(uintptr_t)userdata2); // NOTE: Cancelled work is considered completed so nothing waits forever
+			}, .userdata1 = new userdata(submissions), .userdata2 = (void*)(uintptr_t)serial
+		});
+
+		std::scoped_lock lock(submissions->mutex);
+		if (serial > submissions->completed) // The callback may have already fired
+			submissions->pending.emplace(serial, future);
+		return serial;
+	}
+
+	uint64_t device::submit(std::span<const WGPUCommandBuffer> commands) {
+		auto serial = try_submit(commands);
+		if (!serial) STYLIZER_API_THROW(error_message(serial.error()));
+		return *serial;
+	}
+
+	bool device::is_lost() const {
+		return submissions && submissions->lost;
+	}
+
+	uint64_t device::completed_serial() const {
+		return submissions ? submissions->completed.load() : 0;
+	}
+
+	bool device::wait(uint64_t serial, std::optional<std::chrono::nanoseconds> timeout /* = {} */) {
+		if (serial <= completed_serial()) return true;
+
+		WGPUFuture future;
+		{
+			// NOTE: Holding the submit lock (taken in the same order as try_submit) means a submit racing on another thread
+			// 	has registered its future before we look for it, so a missing serial has always completed
+			std::scoped_lock submit_lock(submissions->submit_mutex);
+			std::scoped_lock lock(submissions->mutex);
+			assert(serial <= submissions->last_submitted && "Can only wait on serials returned by submit!");
+			auto found = submissions->pending.lower_bound(serial);
+			if (found == submissions->pending.end()) // Already completed
+				return serial <= completed_serial();
+			future = found->second;
+		}
+		return wait(future, timeout) || serial <= completed_serial();
+	}
+
+	api::device& device::on_completed(uint64_t serial, std::function<void()>&& callback) {
+		{
+			std::scoped_lock lock(submissions->mutex);
+			if (serial > submissions->completed) {
+				submissions->callbacks.emplace(serial, std::move(callback));
+				return *this;
+			}
+		}
+		callback();
+		return *this;
+	}
+
 	webgpu::texture device::create_texture(const api::texture::create_config& config /* = {} */) {
 		return webgpu::texture::create(*this, config);
 	}
 
 	api::texture& device::create_texture(temporary_return_t, const api::texture::create_config& config /* = {} */) {
-		static webgpu::texture temp;
-		return temp = create_texture(config);
+		return temporary_storage(create_texture(config));
 	}
 
 	webgpu::texture device::create_and_write_texture(std::span<const std::byte> data, const api::texture::data_layout& layout, const api::texture::create_config& config /* = {} */) {
@@ -139,8 +545,7 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::texture& device::create_and_write_texture(temporary_return_t, std::span<const std::byte> data, const api::texture::data_layout& layout, const api::texture::create_config& config /* = {} */) {
-		static webgpu::texture temp;
-		return temp = create_and_write_texture(data, layout, config);
+		return temporary_storage(create_and_write_texture(data, layout, config));
 	}
 
 	webgpu::buffer device::create_buffer(usage usage, size_t size, bool mapped_at_creation /* = false */, const std::string_view label /* = "Stylizer Buffer" */) {
@@ -148,8 +553,7 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::buffer& device::create_buffer(temporary_return_t, usage usage, size_t size, bool mapped_at_creation /* = false */, const std::string_view label /* = "Stylizer Buffer" */) {
-		static webgpu::buffer temp;
-		return temp = create_buffer(usage, size, mapped_at_creation);
+		return temporary_storage(create_buffer(usage, size, mapped_at_creation, label));
 	}
 
 	webgpu::buffer device::create_and_write_buffer(usage usage, std::span<const std::byte> data, size_t offset /* = 0 */, const std::string_view label /* = "Stylizer Buffer" */) {
@@ -157,40 +561,35 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::buffer& device::create_and_write_buffer(temporary_return_t, usage usage, std::span<const std::byte> data, size_t offset /* = 0 */, const std::string_view label /* = "Stylizer Buffer" */) {
-		static webgpu::buffer temp;
-		return temp = create_and_write_buffer(usage, data, offset, label);
+		return temporary_storage(create_and_write_buffer(usage, data, offset, label));
 	}
 
 	webgpu::shader device::create_shader_from_wgsl(const std::string_view wgsl, const std::string_view label /* = "Stylizer Shader" */) {
 		return webgpu::shader::create_from_wgsl(*this, wgsl, label);
 	}
 	api::shader& device::create_shader_from_wgsl(temporary_return_t, const std::string_view wgsl, const std::string_view label /* = "Stylizer Shader" */) {
-		static webgpu::shader temp;
-		return temp = create_shader_from_wgsl(wgsl, label);
+		return temporary_storage(create_shader_from_wgsl(wgsl, label));
 	}
 
 	webgpu::shader device::create_shader_from_session(shader::stage stage, slcross::session session, const std::string_view entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
 		return webgpu::shader::create_from_session(*this, stage, session, entry_point, label);
 	}
 	api::shader& device::create_shader_from_session(temporary_return_t, shader::stage stage, slcross::session session, const std::string_view entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
-		static webgpu::shader temp;
-		return temp = create_shader_from_session(stage, session, entry_point, label);
+		return temporary_storage(create_shader_from_session(stage, session, entry_point, label));
 	}
 
 	webgpu::shader device::create_shader_from_spirv(shader::stage stage, spirv_view spirv, const std::string_view entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
 		return webgpu::shader::create_from_spirv(*this, stage, spirv, entry_point, label);
 	}
 	api::shader& device::create_shader_from_spirv(temporary_return_t, shader::stage stage, spirv_view spirv, const std::string_view entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
-		static webgpu::shader temp;
-		return temp = create_shader_from_spirv(stage, spirv, entry_point, label);
+		return temporary_storage(create_shader_from_spirv(stage, spirv, entry_point, label));
 	}
 
 	webgpu::shader device::create_shader_from_source(shader::language lang, shader::stage stage, const std::string_view source, std::optional<const std::string_view> entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
 		return webgpu::shader::create_from_source(*this, lang, stage, source, entry_point.value_or("main"), label);
 	}
 	api::shader& device::create_shader_from_source(temporary_return_t, shader::language lang, shader::stage stage, const std::string_view source, std::optional<const std::string_view> entry_point /* = "main" */, const std::string_view label /* = "Stylizer Shader" */) {
-		static webgpu::shader temp;
-		return temp = create_shader_from_source(lang, stage, source, entry_point.value_or("main"), label);
+		return temporary_storage(create_shader_from_source(lang, stage, source, entry_point.value_or("main"), label));
 	}
 
 	webgpu::command_encoder device::create_command_encoder(bool one_shot /* = false */, const std::string_view label /* = "Stylizer Command Encoder" */) {
@@ -198,8 +597,7 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::command_encoder& device::create_command_encoder(temporary_return_t, bool one_shot /* = false */, const std::string_view label /* = "Stylizer Command Encoder" */) {
-		static webgpu::command_encoder temp;
-		return temp = create_command_encoder(one_shot, label);
+		return temporary_storage(create_command_encoder(one_shot, label));
 	}
 
 	webgpu::render_pass device::create_render_pass(std::span<const api::render_pass::color_attachment> colors, std::optional<api::render_pass::depth_stencil_attachment> depth /* = {} */, bool one_shot /* = false */, const std::string_view label /* = "Stylizer Render Pass" */) {
@@ -207,8 +605,14 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::render_pass& device::create_render_pass(temporary_return_t, std::span<const api::render_pass::color_attachment> colors, const std::optional<api::render_pass::depth_stencil_attachment>& depth /* = {} */, bool one_shot /* = false */, const std::string_view label /* = "Stylizer Render Pass" */) {
-		static webgpu::render_pass temp;
-		return temp = create_render_pass(colors, depth, one_shot, label);
+		return temporary_storage(create_render_pass(colors, depth, one_shot, label));
+	}
+
+	webgpu::render_pass device::create_command_recorder(bool one_shot /* = false */, const std::string_view label /* = "Stylizer Command Recorder" */) {
+		return render_pass::create(*this, {}, {}, one_shot, label);
+	}
+	api::render_pass& device::create_command_recorder(temporary_return_t, bool one_shot /* = false */, const std::string_view label /* = "Stylizer Command Recorder" */) {
+		return temporary_storage(create_command_recorder(one_shot, label));
 	}
 
 	webgpu::compute_pipeline device::create_compute_pipeline(const pipeline::entry_point& entry_point, const std::string_view label /* = "Stylizer Compute Pipeline" */) {
@@ -216,8 +620,7 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::compute_pipeline& device::create_compute_pipeline(temporary_return_t, const pipeline::entry_point& entry_point, const std::string_view label /* = "Stylizer Compute Pipeline" */) {
-		static webgpu::compute_pipeline temp;
-		return temp = create_compute_pipeline(entry_point, label);
+		return temporary_storage(create_compute_pipeline(entry_point, label));
 	}
 
 	webgpu::render_pipeline device::create_render_pipeline(const pipeline::entry_points& entry_points, std::span<const color_attachment> color_attachments /* = {} */, std::optional<depth_stencil_attachment> depth_attachment /* = {} */, const api::render_pipeline::config& config /* = {} */, const std::string_view label /* = "Stylizer Render Pipeline" */) {
@@ -225,8 +628,7 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::render_pipeline& device::create_render_pipeline(temporary_return_t, const pipeline::entry_points& entry_points, std::span<const color_attachment> color_attachments /* = {} */, const std::optional<depth_stencil_attachment>& depth_attachment /* = {} */, const api::render_pipeline::config& config /* = {} */, const std::string_view label /* = "Stylizer Render Pipeline" */) {
-		static webgpu::render_pipeline temp;
-		return temp = create_render_pipeline(entry_points, color_attachments, depth_attachment, config, label);
+		return temporary_storage(create_render_pipeline(entry_points, color_attachments, depth_attachment, config, label));
 	}
 
 	webgpu::render_pipeline device::create_render_pipeline_from_compatible_render_pass(const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config /* = {} */, const std::string_view label /* = "Stylizer Render Pipeline" */) {
@@ -234,17 +636,20 @@ namespace stylizer::api::webgpu {
 	}
 
 	api::render_pipeline& device::create_render_pipeline_from_compatible_render_pass(temporary_return_t, const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config /* = {} */, const std::string_view label /* = "Stylizer Render Pipeline" */) {
-		static webgpu::render_pipeline temp;
-		return temp = create_render_pipeline_from_compatible_render_pass(entry_points, compatible_render_pass, config, label);
+		return temporary_storage(create_render_pipeline_from_compatible_render_pass(entry_points, compatible_render_pass, config, label));
 	}
 
-	void device::release(bool static_sub_objects /* = false */) {
-		if (static_sub_objects) {
-			static stylizer::auto_release<device> device = {};
-			device.release(false);
-			device = std::move(*this);
-			return;
-		}
+	webgpu::render_bundle device::create_render_bundle(std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment /* = {} */, const std::string_view label /* = "Stylizer Render Bundle" */) {
+		return webgpu::render_bundle::create(*this, color_attachments, depth_attachment, label);
+	}
+
+	api::render_bundle& device::create_render_bundle(temporary_return_t, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment /* = {} */, const std::string_view label /* = "Stylizer Render Bundle" */) {
+		return temporary_storage(create_render_bundle(color_attachments, depth_attachment, label));
+	}
+
+	void device::release() {
+		caches.reset(); // Cached objects need to be released before the device which created them
+		objects.reset();
 		if (device_) wgpuDeviceRelease(std::exchange(device_, nullptr));
 		if (adapter) wgpuAdapterRelease(std::exchange(adapter, nullptr));
 	}
@@ -0,0 +1,123 @@
+#include "common.hpp"
+
+namespace stylizer::api::webgpu {
+	render_bundle render_bundle::create(api::device& device_, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment /* = {} */, const std::string_view label /* = "Stylizer Render Bundle" */) {
+		assert(color_attachments.size() > 0 || depth_attachment.has_value());
+		auto& device = confirm_webgpu_type<webgpu::device>(device_);
+
+		render_bundle out;
+		out.label = label;
+
+		// NOTE: Bundles only care about the formats (and sample count) of the attachments they will be executed with
+		uint32_t samples = 1;
+		std::vector<WGPUTextureFormat> color_formats; color_formats.reserve(color_attachments.size());
+		for(auto& attach: color_attachments) {
+			assert(attach.texture || attach.view || attach.texture_format != texture_format::Undefined);
+			color_formats.emplace_back(to_webgpu(attach.texture ? attach.texture->texture_format()
+				: attach.view ? attach.view->texture().texture_format() : attach.texture_format));
+			if(attach.texture) samples = attach.texture->samples();
+			else if(attach.view) samples = attach.view->texture().samples();
+		}
+
+		WGPURenderBundleEncoderDescriptor d = WGPU_RENDER_BUNDLE_ENCODER_DESCRIPTOR_INIT;
+		d.label = to_webgpu_label(out.label);
+		d.colorFormatCount = color_formats.size();
+		d.colorFormats = color_formats.data();
+		if(depth_attachment) {
+			assert(depth_attachment->texture || depth_attachment->view || depth_attachment->texture_format != texture_format::Undefined);
+			d.depthStencilFormat = to_webgpu(depth_attachment->texture ? depth_attachment->texture->texture_format()
+				: depth_attachment->view ? depth_attachment->view->texture().texture_format() : depth_attachment->texture_format);
+			if(color_formats.empty()) {
+				if(depth_attachment->texture) samples = depth_attachment->texture->samples();
+				else if(depth_attachment->view) samples = depth_attachment->view->texture().samples();
+			}
+			d.depthReadOnly = depth_attachment->depth_readonly;
+			d.stencilReadOnly = depth_attachment->stencil.has_value() && depth_attachment->stencil->readonly;
+		}
+		d.sampleCount = samples;
+		out.encoder = wgpuDeviceCreateRenderBundleEncoder(device.device_, &d);
+		return out;
+	}
+
+	api::render_bundle& render_bundle::bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline_) {
+		assert(encoder); // Can't record into a finished bundle!
+		auto& pipeline = confirm_webgpu_type<webgpu::render_pipeline>(pipeline_);
+		if(bound.update_pipeline(pipeline.pipeline, redundant_binds_skipped))
+			wgpuRenderBundleEncoderSetPipeline(encoder, pipeline.pipeline);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::bind_render_group(api::device& device, const api::bind_group& group_, std::optional<size_t> index_override /* = {} */) {
+		assert(encoder);
+		auto& group = confirm_webgpu_type<webgpu::bind_group>(group_);
+		auto index = index_override.value_or(group.index);
+		if(bound.update_group(index, group.group, redundant_binds_skipped))
+			wgpuRenderBundleEncoderSetBindGroup(encoder, index, group.group, 0, nullptr);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer_, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size_override /* = {} */) {
+		assert(encoder);
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(buffer_);
+		bound_state::buffer_binding binding = {buffer.buffer_, offset.value_or(0), size_override.value_or(buffer.size())};
+		if(bound.update_vertex_buffer(slot, binding, redundant_binds_skipped))
+			wgpuRenderBundleEncoderSetVertexBuffer(encoder, slot, binding.buffer, binding.offset, binding.size);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::bind_index_buffer(api::device& device, const api::buffer& buffer_, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size_override /* = {} */) {
+		assert(encoder);
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(buffer_);
+		bound_state::buffer_binding binding = {buffer.buffer_, offset.value_or(0), size_override.value_or(buffer.size())};
+		if(bound.update_index_buffer(binding, redundant_binds_skipped))
+			wgpuRenderBundleEncoderSetIndexBuffer(encoder, binding.buffer, WGPUIndexFormat_Uint32, binding.offset, binding.size);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count /* = 1 */, std::optional<size_t> first_vertex /* = 0 */, size_t first_instance /* = 0 */) {
+		assert(encoder);
+		wgpuRenderBundleEncoderDraw(encoder, vertex_count, instance_count.value_or(1), first_vertex.value_or(0), first_instance);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count /* = 1 */, std::optional<size_t> first_index /* = 0 */, std::optional<size_t> base_vertex /* = 0 */, size_t first_instance /* = 0 */) {
+		assert(encoder);
+		wgpuRenderBundleEncoderDrawIndexed(encoder, index_count, instance_count.value_or(1), first_index.value_or(0), base_vertex.value_or(0), first_instance);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset /* = 0 */) {
+		assert(encoder);
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(indirect_buffer);
+		assert(flags_set(buffer.usage(), usage::Indirect));
+		assert(offset % 4 == 0 && offset + 4 * sizeof(uint32_t) <= buffer.size());
+		wgpuRenderBundleEncoderDrawIndirect(encoder, buffer.buffer_, offset);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset /* = 0 */) {
+		assert(encoder);
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(indirect_buffer);
+		assert(flags_set(buffer.usage(), usage::Indirect));
+		assert(offset % 4 == 0 && offset + 5 * sizeof(uint32_t) <= buffer.size());
+		wgpuRenderBundleEncoderDrawIndexedIndirect(encoder, buffer.buffer_, offset);
+		return *this;
+	}
+
+	api::render_bundle& render_bundle::finish(api::device& device) {
+		assert(encoder);
+		WGPURenderBundleDescriptor d = WGPU_RENDER_BUNDLE_DESCRIPTOR_INIT;
+		d.label = to_webgpu_label(label);
+		bundle = wgpuRenderBundleEncoderFinish(encoder, &d);
+		wgpuRenderBundleEncoderRelease(std::exchange(encoder, nullptr));
+		bound.reset();
+		return *this;
+	}
+
+	void render_bundle::release() {
+		if(encoder) wgpuRenderBundleEncoderRelease(std::exchange(encoder, nullptr));
+		if(bundle) wgpuRenderBundleRelease(std::exchange(bundle, nullptr));
+	}
+
+	static_assert(render_bundle_concept<render_bundle>);
+} // namespace stylizer::api::webgpu
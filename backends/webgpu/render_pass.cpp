@@ -2,78 +2,131 @@
 
 namespace stylizer::api::webgpu {
 	render_pass render_pass::create(api::device& device_, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth /* = {} */, bool one_shot /* = false */, const std::string_view label_ /* = "Stylizer Render Pass" */) {
-		assert(colors.size() > 0);
+		// NOTE: A render pass without attachments is a command recorder, it can't draw until begin_render_pass is called
 		assert(!(depth.has_value() && depth->depth_clear_value.has_value()) || depth->depth_clear_value >= 0);
 		assert(!(depth.has_value() && depth->depth_clear_value.has_value()) || depth->depth_clear_value <= 1);
 		auto& device = confirm_webgpu_type<webgpu::device>(device_);
 
 		render_pass out({colors.begin(), colors.end()}, depth);
-		std::string label = out.label = label_;
+		out.label = label_;
 		out.one_shot = one_shot;
 
-		{
-			label += "Encoder";
-			WGPUCommandEncoderDescriptor d { .label = to_webgpu(label) };
-			out.render_encoder = wgpuDeviceCreateCommandEncoder(device.device_, &d);
-		}
+		for(auto& attach: colors) assert(attach.texture || attach.view);
+		assert(!depth.has_value() || depth->texture || depth->view);
+		return out;
+	}
+
+	api::render_pass& render_pass::begin_render_pass(api::device& device_, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth /* = {} */) {
+		assert(colors.size() > 0 || depth.has_value());
+		auto& device = confirm_webgpu_type<webgpu::device>(device_);
+		this->end_compute_pass();
+		end_render_pass();
+		color_attachments = {colors.begin(), colors.end()};
+		depth_attachment = depth;
+		pass_begun = false;
+		interrupted_state.reset();
+		maybe_begin_render_pass(device); // Begun eagerly so that clears happen even if nothing is drawn
+		return *this;
+	}
 
-		std::vector<WGPURenderPassColorAttachment> color_attachments; color_attachments.reserve(colors.size());
-		for(auto& attach: colors) {
-			assert(attach.texture || attach.view);
+	api::render_pass& render_pass::end_pass(api::device& device) {
+		super::end_pass(device);
+		// Forget the attachments so drawing without another begin_render_pass asserts (instead of silently resuming the ended pass)
+		color_attachments.clear();
+		depth_attachment.reset();
+		pass_begun = false;
+		interrupted_state.reset();
+		return *this;
+	}
+
+	WGPURenderPassEncoder render_pass::maybe_begin_render_pass(webgpu::device& device) {
+		if(pass) return pass;
+		assert(!color_attachments.empty() || depth_attachment.has_value()); // Command recorders (and passes after end_pass) must call begin_render_pass first!
+		this->end_compute_pass();
+		// When resuming an interrupted pass whatever was previously stored must be loaded instead of cleared
+		bool resume = std::exchange(pass_begun, true);
+		// NOTE: Attachments which aren't stored lost their contents when the pass was interrupted, loading them would
+		// 	read undefined contents so they are cleared again instead (which is reported since earlier draws are lost)
+		auto load_op = [this, resume](bool has_clear_value, bool stored) {
+			if(!resume) return has_clear_value ? WGPULoadOp_Clear : WGPULoadOp_Load;
+			if(stored) return WGPULoadOp_Load;
+			STYLIZER_API_REPORT(stylizer::error_severity::Warning, "Render pass " + std::string(label.view()) + " was interrupted (by a copy or compute dispatch) while an attachment isn't stored, its contents have been lost and it is cleared again", 0);
+			return WGPULoadOp_Clear;
+		};
+
+		std::vector<WGPURenderPassColorAttachment> colors; colors.reserve(color_attachments.size());
+		for(auto& attach: color_attachments) {
 			auto& unconfirmed_view = attach.texture ? confirm_webgpu_type<webgpu::texture>(*attach.texture).full_view(device) : *attach.view;
 			auto& view = confirm_webgpu_type<webgpu::texture_view>(unconfirmed_view);
-			color_attachments.emplace_back(WGPURenderPassColorAttachment{
+			colors.emplace_back(WGPURenderPassColorAttachment{
 				.view = view.view,
 				.depthSlice = WGPU_DEPTH_SLICE_UNDEFINED,
 				.resolveTarget = attach.resolve_target ? confirm_webgpu_type<webgpu::texture_view>(*attach.resolve_target).view : nullptr,
-				.loadOp = attach.clear_value.has_value() ? WGPULoadOp_Clear : WGPULoadOp_Load,
+				.loadOp = load_op(attach.clear_value.has_value(), attach.should_store),
 				.storeOp = attach.should_store ? WGPUStoreOp_Store : WGPUStoreOp_Discard,
 				.clearValue = attach.clear_value.has_value() ? to_webgpu(*attach.clear_value) : WGPUColor{},
 			});
 		}
-		WGPURenderPassDepthStencilAttachment* depth_attachment = nullptr;
-		if(depth) {
-			assert(depth->texture || depth->view);
-			auto& view = confirm_webgpu_type<webgpu::texture_view>(depth->texture ? confirm_webgpu_type<webgpu::texture>(*depth->texture).full_view(device) : *depth->view);
-			bool hasStencil = depth->stencil.has_value();
-			auto stencil = depth->stencil.value_or(depth_stencil_attachment::stencil_config{});
-			auto loadOP = stencil.clear_value.has_value() ? WGPULoadOp_Clear : WGPULoadOp_Load;
+		WGPURenderPassDepthStencilAttachment depth_storage;
+		WGPURenderPassDepthStencilAttachment* depth = nullptr;
+		if(depth_attachment) {
+			auto& view = confirm_webgpu_type<webgpu::texture_view>(depth_attachment->texture ? confirm_webgpu_type<webgpu::texture>(*depth_attachment->texture).full_view(device) : *depth_attachment->view);
+			bool hasStencil = depth_attachment->stencil.has_value();
+			auto stencil = depth_attachment->stencil.value_or(depth_stencil_attachment::stencil_config{});
+			auto loadOP = hasStencil ? load_op(stencil.clear_value.has_value(), stencil.should_store) : WGPULoadOp_Undefined;
 			auto storeOP = stencil.should_store ? WGPUStoreOp_Store : WGPUStoreOp_Discard;
 
-			static WGPURenderPassDepthStencilAttachment static_depth;
-			static_depth = {
+			depth_storage = {
 				.view = view.view,
-				.depthLoadOp = depth->depth_clear_value.has_value() ? WGPULoadOp_Clear : WGPULoadOp_Load,
-				.depthStoreOp = depth->should_store_depth ? WGPUStoreOp_Store : WGPUStoreOp_Discard,
-				.depthClearValue = depth->depth_clear_value.has_value() ? *depth->depth_clear_value : 1,
-				.depthReadOnly = depth->depth_readonly,
+				.depthLoadOp = load_op(depth_attachment->depth_clear_value.has_value(), depth_attachment->should_store_depth),
+				.depthStoreOp = depth_attachment->should_store_depth ? WGPUStoreOp_Store : WGPUStoreOp_Discard,
+				.depthClearValue = depth_attachment->depth_clear_value.has_value() ? *depth_attachment->depth_clear_value : 1,
+				.depthReadOnly = depth_attachment->depth_readonly,
 				.stencilLoadOp = hasStencil ? loadOP : WGPULoadOp_Undefined,
 				.stencilStoreOp = hasStencil ? storeOP : WGPUStoreOp_Undefined,
 				.stencilClearValue = static_cast<uint32_t>(stencil.clear_value.has_value() ? *stencil.clear_value : 0),
 				.stencilReadOnly = stencil.readonly,
 			};
-			depth_attachment = &static_depth;
+			depth = &depth_storage;
 		}
 
-		{
-			WGPURenderPassDescriptor d = WGPU_RENDER_PASS_DESCRIPTOR_INIT;
-			d.label = to_webgpu(label),
-			d.colorAttachmentCount = color_attachments.size(),
-			d.colorAttachments = color_attachments.data(),
-			d.depthStencilAttachment = depth_attachment,
-			d.occlusionQuerySet = nullptr,
-			d.timestampWrites = nullptr,
-			out.pass = wgpuCommandEncoderBeginRenderPass(out.render_encoder, &d);
+		WGPURenderPassDescriptor d = WGPU_RENDER_PASS_DESCRIPTOR_INIT;
+		d.label = to_webgpu_label(label);
+		d.colorAttachmentCount = colors.size();
+		d.colorAttachments = colors.data();
+		d.depthStencilAttachment = depth;
+		d.occlusionQuerySet = nullptr;
+		d.timestampWrites = nullptr;
+		pass = wgpuCommandEncoderBeginRenderPass(this->maybe_create_encoder(device), &d);
+
+		// The user never ended the pass, so whatever they bound before it was interrupted must still be bound
+		if(resume) {
+			bound = std::exchange(interrupted_state, {});
+			if(bound.pipeline) wgpuRenderPassEncoderSetPipeline(pass, (WGPURenderPipeline)bound.pipeline);
+			for(size_t i = 0; i < bound.groups.size(); ++i)
+				if(bound.groups[i]) wgpuRenderPassEncoderSetBindGroup(pass, i, bound.groups[i], 0, nullptr);
+			for(size_t i = 0; i < bound.vertex_buffers.size(); ++i)
+				if(auto& binding = bound.vertex_buffers[i]; binding.buffer)
+					wgpuRenderPassEncoderSetVertexBuffer(pass, i, binding.buffer, binding.offset, binding.size);
+			if(bound.index_buffer.buffer)
+				wgpuRenderPassEncoderSetIndexBuffer(pass, bound.index_buffer.buffer, WGPUIndexFormat_Uint32, bound.index_buffer.offset, bound.index_buffer.size);
 		}
+		return pass;
+	}
 
-		return out;
+	void render_pass::end_render_pass() {
+		if(!pass) return;
+		wgpuRenderPassEncoderEnd(pass);
+		wgpuRenderPassEncoderRelease(std::exchange(pass, nullptr));
+		interrupted_state = std::exchange(bound, {}); // Replayed if the pass gets resumed
 	}
 
 	api::render_pass& render_pass::bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline_, bool release_on_submit /*=  false */) {
-		render_used = true;
 		auto& pipeline = confirm_webgpu_type<webgpu::render_pipeline>(pipeline_);
-		wgpuRenderPassEncoderSetPipeline(pass, pipeline.pipeline);
-		if(release_on_submit) deferred_to_release->connect([pipeline = std::move(pipeline)]() mutable {
+		auto encoder_pass = maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device));
+		if(bound.update_pipeline(pipeline.pipeline, redundant_binds_skipped))
+			wgpuRenderPassEncoderSetPipeline(encoder_pass, pipeline.pipeline);
+		if(release_on_submit) deferred_to_release.push([pipeline = std::move(pipeline)]() mutable {
 			pipeline.release();
 		});
 		return *this;
@@ -81,71 +134,87 @@ namespace stylizer::api::webgpu {
 
 	api::render_pass& render_pass::bind_render_group(api::device& device, const api::bind_group& group_, std::optional<bool> release_on_submit /* = false */, std::optional<size_t> index_override /* = {} */) {
 		auto& group = confirm_webgpu_type<webgpu::bind_group>(group_);
-		wgpuRenderPassEncoderSetBindGroup(pass, index_override.value_or(group.index), group.group, 0, nullptr);
-		if(release_on_submit.value_or(false)) deferred_to_release->connect([group = std::move(group)]() mutable {
+		auto encoder_pass = maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device));
+		auto index = index_override.value_or(group.index);
+		if(bound.update_group(index, group.group, redundant_binds_skipped))
+			wgpuRenderPassEncoderSetBindGroup(encoder_pass, index, group.group, 0, nullptr);
+		if(release_on_submit.value_or(false)) deferred_to_release.push([group = std::move(group)]() mutable {
 			group.release();
 		});
 		return *this;
 	}
 	api::render_pass& render_pass::bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer_, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size_override /* = {} */) {
-		render_used = true;
 		auto& buffer = confirm_webgpu_type<webgpu::buffer>(buffer_);
-		wgpuRenderPassEncoderSetVertexBuffer(pass, slot, buffer.buffer_, offset.value_or(0), size_override.value_or(buffer.size()));
+		auto encoder_pass = maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device));
+		bound_state::buffer_binding binding = {buffer.buffer_, offset.value_or(0), size_override.value_or(buffer.size())};
+		if(bound.update_vertex_buffer(slot, binding, redundant_binds_skipped))
+			wgpuRenderPassEncoderSetVertexBuffer(encoder_pass, slot, binding.buffer, binding.offset, binding.size);
 		return *this;
 	}
 	api::render_pass& render_pass::bind_index_buffer(api::device& device, const api::buffer& buffer_, std::optional<size_t> offset /* = 0 */, std::optional<size_t> size_override /* = {} */) {
-		render_used = true;
 		auto& buffer = confirm_webgpu_type<webgpu::buffer>(buffer_);
-		wgpuRenderPassEncoderSetIndexBuffer(pass, buffer.buffer_, WGPUIndexFormat_Uint32, offset.value_or(0), size_override.value_or(buffer.size()));
+		auto encoder_pass = maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device));
+		bound_state::buffer_binding binding = {buffer.buffer_, offset.value_or(0), size_override.value_or(buffer.size())};
+		if(bound.update_index_buffer(binding, redundant_binds_skipped))
+			wgpuRenderPassEncoderSetIndexBuffer(encoder_pass, binding.buffer, WGPUIndexFormat_Uint32, binding.offset, binding.size);
 		return *this;
 	}
 	api::render_pass& render_pass::draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count /* = 1 */, std::optional<size_t> first_vertex /* = 0 */, size_t first_instance /* = 0 */) {
-		render_used = true;
-		wgpuRenderPassEncoderDraw(pass, vertex_count, instance_count.value_or(1), first_vertex.value_or(0), first_instance);
+		wgpuRenderPassEncoderDraw(maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device)), vertex_count, instance_count.value_or(1), first_vertex.value_or(0), first_instance);
 		return *this;
 	}
 	api::render_pass& render_pass::draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count /* = 1 */, std::optional<size_t> first_index /* = 0 */, std::optional<size_t> base_vertex /* = 0 */, size_t first_instance /* = 0 */) {
-		render_used = true;
-		wgpuRenderPassEncoderDrawIndexed(pass, index_count, instance_count.value_or(1), first_index.value_or(0), base_vertex.value_or(0), first_instance);
+		wgpuRenderPassEncoderDrawIndexed(maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device)), index_count, instance_count.value_or(1), first_index.value_or(0), base_vertex.value_or(0), first_instance);
 		return *this;
 	}
 
-	webgpu::command_buffer render_pass::end(api::device& device) {
-		if(compute_pass) wgpuComputePassEncoderEnd(compute_pass);
-		command_buffer out;
-		WGPUCommandBufferDescriptor d = WGPU_COMMAND_BUFFER_DESCRIPTOR_INIT;
-		if(pre_encoder) out.pre = wgpuCommandEncoderFinish(pre_encoder, &d);
-		if(compute_encoder) out.compute = wgpuCommandEncoderFinish(compute_encoder, &d);
-		if(render_used) {
-			wgpuRenderPassEncoderEnd(pass);
-			out.render = wgpuCommandEncoderFinish(render_encoder, &d);
-		}
-		{ // TODO: Why does this have to be two steps?
-			auto& deferred = *deferred_to_release;
-			out.deferred_to_release = std::move(deferred);
+	api::render_pass& render_pass::draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset /* = 0 */) {
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(indirect_buffer);
+		assert(flags_set(buffer.usage(), usage::Indirect));
+		assert(offset % 4 == 0 && offset + 4 * sizeof(uint32_t) <= buffer.size());
+		wgpuRenderPassEncoderDrawIndirect(maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device)), buffer.buffer_, offset);
+		return *this;
+	}
+	api::render_pass& render_pass::draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset /* = 0 */) {
+		auto& buffer = confirm_webgpu_type<webgpu::buffer>(indirect_buffer);
+		assert(flags_set(buffer.usage(), usage::Indirect));
+		assert(offset % 4 == 0 && offset + 5 * sizeof(uint32_t) <= buffer.size());
+		wgpuRenderPassEncoderDrawIndexedIndirect(maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device)), buffer.buffer_, offset);
+		return *this;
+	}
+
+	api::render_pass& render_pass::execute_bundles(api::device& device, std::span<const api::render_bundle* const> bundles) {
+		auto encoder_pass = maybe_begin_render_pass(confirm_webgpu_type<webgpu::device>(device));
+		std::vector<WGPURenderBundle> webgpu_bundles; webgpu_bundles.reserve(bundles.size());
+		for(auto bundle: bundles) {
+			assert(bundle && bundle->finished());
+			webgpu_bundles.emplace_back(confirm_webgpu_type<webgpu::render_bundle>(*bundle).bundle);
 		}
-		return out;
+		wgpuRenderPassEncoderExecuteBundles(encoder_pass, webgpu_bundles.size(), webgpu_bundles.data());
+		bound.reset(); // Executing bundles resets the pass's bound state
+		return *this;
+	}
+
+	webgpu::command_buffer render_pass::end(api::device& device) {
+		return finish();
 	}
 	api::command_buffer& render_pass::end(temporary_return_t, api::device& device) {
-		static command_buffer buffer;
-		return buffer = end(device);
+		return temporary_storage(end(device));
 	}
 
-	void render_pass::one_shot_submit(api::device& device) {
+	uint64_t render_pass::one_shot_submit(api::device& device) {
 		assert(one_shot);
 		auto buffer = end(device);
-		buffer.submit(device, true);
+		auto serial = buffer.submit(device, true);
 		this->release();
+		return serial;
 	}
 
 	void render_pass::release() {
-		if(pre_encoder) wgpuCommandEncoderRelease(std::exchange(pre_encoder, nullptr));
-		if(compute_encoder) wgpuCommandEncoderRelease(std::exchange(compute_encoder, nullptr));
 		if(compute_pass) wgpuComputePassEncoderRelease(std::exchange(compute_pass, nullptr));
-		// TODO: ^^^ Calling release on command encoder infinitely recurses?
-		if(render_encoder) wgpuCommandEncoderRelease(std::exchange(render_encoder, nullptr));
 		if(pass) wgpuRenderPassEncoderRelease(std::exchange(pass, nullptr));
-		(*deferred_to_release)();
+		if(encoder) wgpuCommandEncoderRelease(std::exchange(encoder, nullptr));
+		deferred_to_release();
 	}
 
 	static_assert(render_pass_concept<render_pass>);
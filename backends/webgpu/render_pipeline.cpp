@@ -364,7 +364,7 @@ namespace stylizer::api::webgpu {
 
 		render_pipeline out;
 		WGPURenderPipelineDescriptor d = WGPU_RENDER_PIPELINE_DESCRIPTOR_INIT;
-		d.label = to_webgpu(label),
+		d.label = to_webgpu_label(label),
 		d.layout = nullptr,
 		d.vertex = {
 			.module = confirm_webgpu_type<webgpu::shader>(*vertex.shader).module,
@@ -402,8 +402,7 @@ namespace stylizer::api::webgpu {
 		return internal_bind_group_create(device, index, wgpuRenderPipelineGetBindGroupLayout(pipeline, index), bindings, label);
 	}
 	api::bind_group& render_pipeline::create_bind_group(temporary_return_t, api::device& device, size_t index, std::span<const bind_group::binding> bindings, std::string_view label /* = "Stylizer Render Bind Group" */) {
-		static webgpu::bind_group group_;
-		return group_ = create_bind_group(device, index, bindings, label);
+		return temporary_storage(create_bind_group(device, index, bindings, label));
 	}
 
 	void render_pipeline::release(){
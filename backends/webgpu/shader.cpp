@@ -14,7 +14,7 @@ namespace stylizer::api::webgpu {
 		};
 		WGPUShaderModuleDescriptor descriptor {
 			.nextInChain = &code.chain,
-			.label = to_webgpu(label),
+			.label = to_webgpu_label(label),
 		};
 		out.module = wgpuDeviceCreateShaderModule(device.device_, &descriptor);
 		return out;
@@ -225,31 +225,45 @@ namespace stylizer::api::webgpu {
 	#define STYLIZER_SURFACE_THROW(x) STYLIZER_API_THROW(x)
 #endif
 
-	texture surface::next_texture(api::device& device) {
+	result<texture> surface::try_next_texture(api::device& device) {
 		WGPUSurfaceTexture texture;
 		wgpuSurfaceGetCurrentTexture(surface_, &texture);
 		switch (texture.status) {
 		case WGPUSurfaceGetCurrentTextureStatus_Timeout:
-			STYLIZER_SURFACE_THROW("Failed to get next surface texture: " "Timed out");
+			return std::unexpected(error_code::SurfaceTimeout);
 		case WGPUSurfaceGetCurrentTextureStatus_Outdated:
-			STYLIZER_SURFACE_THROW("Failed to get next surface texture: " "Outdated");
+			return std::unexpected(error_code::SurfaceOutdated);
 		case WGPUSurfaceGetCurrentTextureStatus_Lost:
-			STYLIZER_SURFACE_THROW("Failed to get next surface texture: " "Current Texture Lost");
+			return std::unexpected(error_code::SurfaceLost);
 		case WGPUSurfaceGetCurrentTextureStatus_Error:
-			STYLIZER_SURFACE_THROW("Failed to get next surface texture: " "Unknown Error");
+			return std::unexpected(error_code::SurfaceError);
 		case WGPUSurfaceGetCurrentTextureStatus_SuccessSuboptimal: [[fallthrough]]; // TODO: Should we do something in the case the success is suboptimal?
 		case WGPUSurfaceGetCurrentTextureStatus_Force32: [[fallthrough]];
 		case WGPUSurfaceGetCurrentTextureStatus_SuccessOptimal:
 			{ /* DO nothing */ }
 		}
 
-		webgpu::texture out;
-		out.texture_ = texture.texture;
-		return out;
+		auto out = webgpu::texture::try_adopt(texture.texture);
+		if (!out) {
+			if (texture.texture) wgpuTextureRelease(texture.texture);
+			STYLIZER_API_REPORT(stylizer::error_severity::Warning, "The surface's texture has a format or usage which can't be represented", 0);
+			return std::unexpected(error_code::SurfaceError);
+		}
+		return std::move(*out);
+	}
+	result<api::texture*> surface::try_next_texture(temporary_return_t, api::device& device) {
+		auto out = try_next_texture(device);
+		if (!out) return std::unexpected(out.error());
+		return &temporary_storage(std::move(*out));
+	}
+
+	texture surface::next_texture(api::device& device) {
+		auto out = try_next_texture(device);
+		if (!out) STYLIZER_SURFACE_THROW(error_message(out.error()));
+		return std::move(*out);
 	}
 	api::texture& surface::next_texture(temporary_return_t, api::device& device) {
-		static webgpu::texture out;
-		return out = next_texture(device);
+		return temporary_storage(next_texture(device));
 	}
 
 	texture_format surface::configured_texture_format(api::device&) {
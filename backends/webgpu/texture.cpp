@@ -65,7 +65,7 @@ namespace stylizer::api::webgpu {
 			.baseMipLevel = static_cast<uint32_t>(config.base_mip_level),
 			.mipLevelCount = static_cast<uint32_t>(config.mip_level_count_override.value_or(texture.mip_levels())),
 			.baseArrayLayer = 0,
-			.arrayLayerCount = wgpuTextureGetDepthOrArrayLayers(texture.texture_),
+			.arrayLayerCount = static_cast<uint32_t>(texture.size_.z),
 			.aspect = to_webgpu(config.aspect),
 		}, texture);
 	}
@@ -82,7 +82,7 @@ namespace stylizer::api::webgpu {
 		WGPUTextureFormat format = to_webgpu(config.format);
 		texture out;
 		WGPUTextureDescriptor d = WGPU_TEXTURE_DESCRIPTOR_INIT;
-		d.label = to_webgpu(config.label),
+		d.label = to_webgpu_label(config.label),
 		d.usage = to_webgpu_texture(config.usage),
 		d.dimension = config.size.y > 1 ? config.size.z > 1 ? WGPUTextureDimension_3D : WGPUTextureDimension_2D : WGPUTextureDimension_1D,
 		d.size = { static_cast<uint32_t>(config.size.x), static_cast<uint32_t>(config.size.y), static_cast<uint32_t>(config.size.z) },
@@ -92,9 +92,36 @@ namespace stylizer::api::webgpu {
 		d.viewFormatCount = 1,
 		d.viewFormats = &format,
 		out.texture_ = wgpuDeviceCreateTexture(device.device_, &d);
+		out.size_ = { d.size.width, d.size.height, d.size.depthOrArrayLayers };
+		out.format_ = config.format;
+		out.usage_ = from_webgpu_texture(d.usage);
+		out.mip_levels_ = d.mipLevelCount;
+		out.samples_ = d.sampleCount;
 		return out;
 	}
 
+	std::optional<texture> texture::try_adopt(WGPUTexture texture) {
+		if (!texture) return {};
+		auto format = try_from_webgpu(wgpuTextureGetFormat(texture));
+		auto usage = try_from_webgpu_texture(wgpuTextureGetUsage(texture));
+		if (!format || !usage) return {};
+
+		webgpu::texture out;
+		out.texture_ = texture;
+		out.size_ = { wgpuTextureGetWidth(texture), wgpuTextureGetHeight(texture), wgpuTextureGetDepthOrArrayLayers(texture) };
+		out.format_ = *format;
+		out.usage_ = *usage;
+		out.mip_levels_ = wgpuTextureGetMipLevelCount(texture);
+		out.samples_ = wgpuTextureGetSampleCount(texture);
+		return out;
+	}
+
+	texture texture::adopt(WGPUTexture texture) {
+		auto out = try_adopt(texture);
+		if (!out) STYLIZER_API_THROW("Failed to adopt texture: its format or usage has no equivalent");
+		return std::move(*out);
+	}
+
 	texture texture::create_and_write(api::device& device, std::span<const std::byte> data, const data_layout& layout, create_config config /* = {} */) {
 		config.size = { data.size() / layout.rows_per_image / bytes_per_pixel(config.format), layout.rows_per_image, 1 };
 		config.usage |= api::usage::CopyDestination;
@@ -107,8 +134,7 @@ namespace stylizer::api::webgpu {
 		return texture_view::create(device, *this, config);
 	}
 	api::texture_view& texture::create_view(temporary_return_t, api::device& device, const view::create_config& config /* = {} */) const {
-		static webgpu::texture_view view;
-		return view = create_view(device, config);
+		return temporary_storage(create_view(device, config));
 	}
 
 	const api::texture_view& texture::full_view(api::device& device, bool treat_as_cubemap /* = false */) const {
@@ -116,31 +142,11 @@ namespace stylizer::api::webgpu {
 		return view = create_view(device, {.treat_as_cubemap = treat_as_cubemap}); // TODO: Do we want to expose control over the aspect?
 	}
 
-	vec3u texture::size() const {
-		auto& texture = texture_;
-		return { wgpuTextureGetWidth(texture), wgpuTextureGetHeight(texture), wgpuTextureGetDepthOrArrayLayers(texture) };
-	}
-
-	texture_format texture::texture_format() const {
-		return from_webgpu(wgpuTextureGetFormat(texture_));
-	}
-
-	usage texture::usage() const {
-		return from_webgpu_texture(wgpuTextureGetUsage(texture_));
-	}
-
-	uint32_t texture::mip_levels() const {
-		return wgpuTextureGetMipLevelCount(texture_);
-	}
-	uint32_t texture::samples() const {
-		return wgpuTextureGetSampleCount(texture_);
-	}
-
 	api::texture& texture::configure_sampler(api::device& device_, const sampler_config& config /* = {} */) {
 		auto& device = confirm_webgpu_type<webgpu::device>(device_);
 		if (sampler) wgpuSamplerRelease(sampler);
 		WGPUSamplerDescriptor d = WGPU_SAMPLER_DESCRIPTOR_INIT;
-		d.label = to_webgpu(config.label),
+		d.label = to_webgpu_label(config.label),
 		d.addressModeU = to_webgpu(config.mode_x_override.value_or(config.mode)),
 		d.addressModeV = to_webgpu(config.mode_y_override.value_or(config.mode)),
 		d.addressModeW = to_webgpu(config.mode_z_override.value_or(config.mode)),
@@ -209,7 +215,7 @@ namespace stylizer::api::webgpu {
 		defer_ { wgpuCommandEncoderRelease(e); };
 		auto min_mip = min_mip_level.value_or(0);
 		copy_texture_to_texture_impl(e, *this, source, destination_origin.value_or(vec3u{0, 0, 0}), source_origin.value_or(vec3u{0, 0, 0}), extent_override.value_or(vec3u{0, 0, 0}), min_mip, mip_levels_override.value_or(source.mip_levels() - min_mip));
-		finish_and_submit(e, device.queue);
+		finish_and_submit(e, device);
 		return *this;
 	}
 
@@ -223,13 +229,13 @@ namespace stylizer::api::webgpu {
 			.clear_value = clear_value
 		}};
 		auto format = texture_format();
-		static thread_local std::unordered_map<texture::format, stylizer::auto_release<webgpu::render_pipeline>> pipeline_cache = {};
-		if(!pipeline_override && pipeline_cache[format])
-			pipeline_override = &pipeline_cache[format];
-
 		webgpu::render_pipeline* pipeline;
 		if(!pipeline_override) {
-			static thread_local stylizer::auto_release<webgpu::shader> shader = webgpu::shader::create_from_wgsl(device, R"_(
+			std::scoped_lock lock(device.caches->mutex);
+			auto& cached = device.caches->blit_pipelines[format];
+			if(!cached) {
+				auto& shader = device.caches->blit_shader;
+				if(!shader) shader = webgpu::shader::create_from_wgsl(device, R"_(
 @group(0) @binding(0) var texture: texture_2d<f32>;
 @group(0) @binding(1) var sampler_: sampler;
 
@@ -265,11 +271,13 @@ fn fragment(v: vertex_output) -> @location(0) vec4f {
 	var vert = v;
 	vert.uv.y = -vert.uv.y; // Unflip v axis
 	return textureSample(texture, sampler_, vert.uv);
-})_");
-			pipeline = &(pipeline_cache[format] = std::move(device.create_render_pipeline({
-				{shader::stage::Vertex, {&shader, "vertex"}},
-				{shader::stage::Fragment, {&shader, "fragment"}},
-			}, attachment, {}, {}, "Stylizer Blit Pipeline")));
+})_", "Stylizer Blit Shader");
+				cached = device.create_render_pipeline({
+					{shader::stage::Vertex, {&shader, "vertex"}},
+					{shader::stage::Fragment, {&shader, "fragment"}},
+				}, attachment, {}, {}, "Stylizer Blit Pipeline");
+			}
+			pipeline = &cached; // NOTE: Cache entries are never replaced so this stays valid after unlocking
 		} else pipeline = &confirm_webgpu_type<webgpu::render_pipeline>(*pipeline_override);
 
 		device.create_render_pass(attachment, {}, true, "Stylizer Blit Renderpass")
@@ -290,8 +298,14 @@ fn fragment(v: vertex_output) -> @location(0) vec4f {
 		uint32_t mip_levels = first_mip_level + mip_levels_override.value_or(size_max_levels - first_mip_level);
 		assert(mip_levels <= size_max_levels);
 
-		auto formatStr = format_to_string(wgpuTextureGetFormat(texture_));
-		stylizer::auto_release mipShader = webgpu::shader::create_from_wgsl(device, R"_(
+		webgpu::compute_pipeline* pipeline;
+		{
+			std::scoped_lock lock(device.caches->mutex);
+			auto format = to_webgpu(format_);
+			auto& cached = device.caches->mipmap_pipelines[format];
+			if(!cached) {
+				auto formatStr = format_to_string(format);
+				stylizer::auto_release mipShader = webgpu::shader::create_from_wgsl(device, R"_(
 @group(0) @binding(0) var previousMipLevel: texture_2d<f32>;
 @group(0) @binding(1) var nextMipLevel: texture_storage_2d<)_" + formatStr + R"_(, write>;
 
@@ -305,14 +319,17 @@ fn compute(@builtin(global_invocation_id) id: vec3<u32>) {
 		textureLoad(previousMipLevel, 2 * id.xy + offset.yy, 0)
 	) * 0.25;
 	textureStore(nextMipLevel, id.xy, color);
-})_");
+})_", "Stylizer Mipmapping Shader");
+				cached = device.create_compute_pipeline({&mipShader, "compute"}, "Stylizer Mipmapping Pipeline");
+			}
+			pipeline = &cached; // NOTE: Cache entries are never replaced so this stays valid after unlocking
+		}
 
 		stylizer::auto_release new_texture = device.create_texture({.format = this->texture_format(), .usage = usage() | usage::CopyDestination | usage::Storage, .size = size, .mip_levels = mip_levels, .samples = samples()});
 		new_texture.copy_from(device, *this, {}, {}, {}, 0, 1);
 
-		stylizer::auto_release pipeline = device.create_compute_pipeline({&mipShader, "compute"}, "Stylizer Mipmapping Pipeline");
 		auto encoder = device.create_command_encoder(true);
-		encoder.bind_compute_pipeline(device, pipeline);
+		encoder.bind_compute_pipeline(device, *pipeline);
 
 		// wgpu::Extent3D mipLevelSize = {size.x, size.y, 1}; // TODO: do we need a tweak to properly handle cubemaps?
 		for (uint32_t level = 1; level < mip_levels; ++level) {
@@ -323,7 +340,7 @@ fn compute(@builtin(global_invocation_id) id: vec3<u32>) {
 			auto current = new_texture.create_view(device, {.base_mip_level = level, .mip_level_count_override = 1});
 
 			vec3u workgroups = {(invocationCount.x + workgroupSizePerDim + 1) / workgroupSizePerDim, (invocationCount.y + workgroupSizePerDim + 1) / workgroupSizePerDim, 1};
-			encoder.bind_compute_group(device, pipeline.create_bind_group(device, 0, std::array<bind_group::binding, 2>{
+			encoder.bind_compute_group(device, pipeline->create_bind_group(device, 0, std::array<bind_group::binding, 2>{
 					bind_group::texture_binding{.texture_view = &previous, .sampled_override = false}, bind_group::texture_binding{.texture_view = &current, .sampled_override = false}
 				}), true)
 				.dispatch_workgroups(device, workgroups);
@@ -1,23 +1,34 @@
 #pragma once
 
 #include "../../api.hpp"
+#include "../../util/inline_string.hpp"
+#include "../../util/slot_map.hpp"
 #include "../../util/string2magic.hpp"
+#include "../../util/temporary_storage.hpp"
 
+#include <array>
+#include <tuple>
 #include <utility>
 #include <webgpu/webgpu.h>
 
 namespace stylizer::api::webgpu {
 	constexpr static uint32_t magic_number = string2magic("WEBGPU");
+#ifdef STYLIZER_API_NO_LABELS
+	constexpr static size_t label_capacity = 0;
+#else
+	constexpr static size_t label_capacity = 64;
+#endif
+	using label_string = stylizer::inline_string<label_capacity>; // Labels longer than label_capacity are truncated
 	struct device;
 	struct texture;
 
 	struct texture_view : public api::texture_view { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(texture_view); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(texture_view);
 		uint32_t type = magic_number;
-		const webgpu::texture* owning_texture;
+		const webgpu::texture* owning_texture = nullptr; // NOTE: Views created by create_view dangle if their texture is moved, only full_view follows it
 		WGPUTextureView view = nullptr;
 
-		inline texture_view(texture_view&& o) { *this = std::move(o); }
-		inline texture_view& operator=(texture_view&& o) {
+		inline texture_view(texture_view&& o) noexcept { *this = std::move(o); }
+		inline texture_view& operator=(texture_view&& o) noexcept {
 			owning_texture = std::exchange(o.owning_texture, nullptr);
 			view = std::exchange(o.view, nullptr);
 			return *this;
@@ -38,28 +49,43 @@ namespace stylizer::api::webgpu {
 		WGPUTexture texture_ = nullptr;
 		WGPUSampler sampler = nullptr;
 		mutable texture_view view = {}; // Mutable so may update while texture is const!
-
-		inline texture(texture&& o) { *this = std::move(o); }
-		inline texture& operator=(texture&& o) {
+		// Immutable properties captured at creation (so reading them doesn't need to call into webgpu)
+		vec3u size_ = {};
+		enum texture_format format_ = texture_format::Undefined;
+		enum usage usage_ = usage::Invalid;
+		uint32_t mip_levels_ = 0;
+		uint32_t samples_ = 0;
+
+		inline texture(texture&& o) noexcept { *this = std::move(o); }
+		inline texture& operator=(texture&& o) noexcept {
 			texture_ = std::exchange(o.texture_, nullptr);
 			sampler = std::exchange(o.sampler, nullptr);
-			view.release(); // Pointers have been invalidated
+			size_ = std::exchange(o.size_, {});
+			format_ = std::exchange(o.format_, texture_format::Undefined);
+			usage_ = std::exchange(o.usage_, usage::Invalid);
+			mip_levels_ = std::exchange(o.mip_levels_, 0);
+			samples_ = std::exchange(o.samples_, 0);
+			view.release();
+			view = std::move(o.view);
+			if (view) view.owning_texture = this; // The full view follows the texture to its new address
 			return *this;
 		}
 		inline operator bool() const override { return texture_ || sampler; }
 
 		static texture create(api::device& device, const create_config& config = {});
 		static texture create_and_write(api::device& device, std::span<const std::byte> data, const data_layout& layout, create_config config = {});
+		static texture adopt(WGPUTexture texture); // Takes ownership and queries the properties of a texture created elsewhere
+		static std::optional<texture> try_adopt(WGPUTexture texture); // Like adopt, but returns nothing (leaving ownership with the caller) if the texture can't be represented
 
 		webgpu::texture_view create_view(api::device& device, const view::create_config& config = {}) const;
 		api::texture_view& create_view(temporary_return_t, api::device& device, const view::create_config& config = {}) const override;
 		const api::texture_view& full_view(api::device& device, bool treat_as_cubemap = false) const override;
 
-		vec3u size() const override;
-		enum texture_format texture_format() const override;
-		enum usage usage() const override;
-		uint32_t mip_levels() const override;
-		uint32_t samples() const override;
+		vec3u size() const override { return size_; }
+		enum texture_format texture_format() const override { return format_; }
+		enum usage usage() const override { return usage_; }
+		uint32_t mip_levels() const override { return mip_levels_; }
+		uint32_t samples() const override { return samples_; }
 
 		api::texture& configure_sampler(api::device& device, const sampler_config& config = {}) override;
 		bool sampled() const override;
@@ -79,10 +105,15 @@ namespace stylizer::api::webgpu {
 	struct buffer : public api::buffer { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(buffer); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(buffer);
 		uint32_t type = magic_number;
 		WGPUBuffer buffer_ = nullptr;
+		// Immutable properties captured at creation
+		size_t size_ = 0;
+		enum usage usage_ = usage::Invalid;
 
-		buffer(buffer&& o) { *this = std::move(o); }
-		buffer& operator=(buffer&& o) {
+		buffer(buffer&& o) noexcept { *this = std::move(o); }
+		buffer& operator=(buffer&& o) noexcept {
 			buffer_ = std::exchange(o.buffer_, nullptr);
+			size_ = std::exchange(o.size_, 0);
+			usage_ = std::exchange(o.usage_, usage::Invalid);
 			return *this;
 		}
 		inline operator bool() const override { return buffer_; }
@@ -96,6 +127,7 @@ namespace stylizer::api::webgpu {
 			return create_and_write(device, usage, byte_span(data), offset, label);
 		}
 
+		// The returned buffer is shared and stays valid (and unchanged) until the device is released, just_released is never written
 		static const buffer& zero_buffer(api::device& device, enum usage usage = usage::Storage, size_t minimum_size = 0, api::buffer* just_released = nullptr);
 		const api::buffer& get_zero_buffer_singleton(api::device& device, enum usage usage = usage::Storage, size_t size = 0, api::buffer* just_released = nullptr) override;
 
@@ -106,8 +138,8 @@ namespace stylizer::api::webgpu {
 			return write(device, byte_span(data), offset);
 		}
 
-		size_t size() const override;
-		enum usage usage() const override;
+		size_t size() const override { return size_; }
+		enum usage usage() const override { return usage_; }
 
 		api::buffer& copy_from(api::device& device, const api::buffer& source, std::optional<size_t> destination_offset = 0, std::optional<size_t> source_offset = 0, std::optional<size_t> size_override = {}) override;
 
@@ -115,6 +147,8 @@ namespace stylizer::api::webgpu {
 
 		std::future<std::byte*> map_async(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override;
 		std::byte* map(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override;
+		std::future<result<std::byte*>> try_map_async(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override;
+		result<std::byte*> try_map(api::device& device, std::optional<bool> for_writing = false, std::optional<size_t> offset = 0, std::optional<size_t> size = {}) override;
 
 		std::byte* get_mapped_range(bool for_writing = false, size_t offset = 0, std::optional<size_t> size = {});
 
@@ -130,8 +164,8 @@ namespace stylizer::api::webgpu {
 		WGPUShaderModule module = nullptr;
 		// api::spirv spirv = {}; // TODO: Can we store some sort of smaller reflection data?
 
-		shader(shader&& o) { *this = std::move(o); }
-		shader& operator=(shader&& o) {
+		shader(shader&& o) noexcept { *this = std::move(o); }
+		shader& operator=(shader&& o) noexcept {
 			module = std::exchange(o.module, nullptr);
 			// spirv = std::exchange(o.spirv, {});
 			return *this;
@@ -151,22 +185,19 @@ namespace stylizer::api::webgpu {
 	struct pipeline : public api::pipeline { };
 	struct command_buffer: public api::command_buffer { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(command_buffer); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(command_buffer);
 		uint32_t type = magic_number;
-		WGPUCommandBuffer pre = nullptr;
-		WGPUCommandBuffer compute = nullptr;
-		WGPUCommandBuffer render = nullptr;
+		WGPUCommandBuffer buffer = nullptr;
 		// TODO: Do we want to support sub command buffers?
 
 		command_buffer(command_buffer&& o) { *this = std::move(o); }
 		command_buffer& operator=(command_buffer&& o) {
 			deferred_to_release = std::move(o.deferred_to_release);
-			pre = std::exchange(o.pre, nullptr);
-			compute = std::exchange(o.compute, nullptr);
-			render = std::exchange(o.render, nullptr);
+			buffer = std::exchange(o.buffer, nullptr);
 			return *this;
 		}
-		inline operator bool() const override { return pre || compute || render; }
+		inline operator bool() const override { return buffer; }
 
-		void submit(api::device& device, bool release = true) override;
+		uint64_t submit(api::device& device, bool release = true) override;
+		result<uint64_t> try_submit(api::device& device, bool release = true) override;
 		void release() override;
 		stylizer::auto_release<command_buffer> auto_release() { return std::move(*this); }
 	};
@@ -176,8 +207,8 @@ namespace stylizer::api::webgpu {
 		WGPUBindGroup group = nullptr;
 		size_t index = 0;
 
-		bind_group(bind_group&& o) { *this = std::move(o); }
-		bind_group& operator=(bind_group&& o) {
+		bind_group(bind_group&& o) noexcept { *this = std::move(o); }
+		bind_group& operator=(bind_group&& o) noexcept {
 			group = std::exchange(o.group, nullptr);
 			index = o.index;
 			return *this;
@@ -194,8 +225,8 @@ namespace stylizer::api::webgpu {
 		uint32_t type = magic_number;
 		WGPUComputePipeline pipeline = nullptr;
 
-		compute_pipeline(compute_pipeline&& o) { *this = std::move(o); }
-		compute_pipeline& operator=(compute_pipeline&& o) {
+		compute_pipeline(compute_pipeline&& o) noexcept { *this = std::move(o); }
+		compute_pipeline& operator=(compute_pipeline&& o) noexcept {
 			pipeline = std::exchange(o.pipeline, nullptr);
 			return *this;
 		}
@@ -211,38 +242,92 @@ namespace stylizer::api::webgpu {
 	};
 	static_assert(compute_pipeline_concept<compute_pipeline>);
 
+	// Tracks what is bound inside of the currently open pass so that binds which wouldn't change anything can be skipped
+	struct bound_state {
+		constexpr static size_t max_bind_groups = 8;
+		constexpr static size_t max_vertex_buffers = 16;
+
+		struct buffer_binding {
+			WGPUBuffer buffer = nullptr;
+			size_t offset = 0, size = 0;
+			bool operator==(const buffer_binding&) const = default;
+		};
+
+		// How many binds were skipped because they matched what was already bound
+		struct skip_counters {
+			size_t pipelines = 0, bind_groups = 0, vertex_buffers = 0, index_buffers = 0;
+			size_t total() const { return pipelines + bind_groups + vertex_buffers + index_buffers; }
+		};
+
+		const void* pipeline = nullptr; // Compute or render depending on the open pass
+		std::array<WGPUBindGroup, max_bind_groups> groups = {};
+		std::array<buffer_binding, max_vertex_buffers> vertex_buffers = {};
+		buffer_binding index_buffer = {};
+
+		// Updates the tracked value, returns false (counting the skip) if it was already bound
+		template<typename T>
+		static bool update(T& bound, const T& value, size_t& skipped) {
+			if(bound == value) { ++skipped; return false; }
+			bound = value;
+			return true;
+		}
+
+		bool update_pipeline(const void* p, skip_counters& skipped) { return update(pipeline, p, skipped.pipelines); }
+		bool update_group(size_t index, WGPUBindGroup group, skip_counters& skipped) {
+			if(index >= groups.size()) return true; // Not tracked
+			return update(groups[index], group, skipped.bind_groups);
+		}
+		bool update_vertex_buffer(size_t slot, buffer_binding binding, skip_counters& skipped) {
+			if(slot >= vertex_buffers.size()) return true; // Not tracked
+			return update(vertex_buffers[slot], binding, skipped.vertex_buffers);
+		}
+		bool update_index_buffer(buffer_binding binding, skip_counters& skipped) { return update(index_buffer, binding, skipped.index_buffers); }
+
+		// Passes don't inherit state from one another
+		void reset() { *this = {}; }
+	};
+
 	template<typename Tapi_return, typename Twebgpu_return>
 	struct command_encoder_base : public Tapi_return { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(command_encoder_base);
 		uint32_t type = magic_number;
-		std::shared_ptr<stylizer::signal<void()>> deferred_to_release = std::make_shared<stylizer::signal<void()>>();
-		WGPUCommandEncoder pre_encoder = nullptr;
-		WGPUCommandEncoder compute_encoder = nullptr;
+		stylizer::deferred_action_list<> deferred_to_release;
+		// NOTE: Everything is recorded into a single encoder in call order, compute (and render) passes are opened as
+		// 	needed and closed whenever something which can't be recorded inside of them comes along
+		WGPUCommandEncoder encoder = nullptr;
 		WGPUComputePassEncoder compute_pass = nullptr;
-		std::string label;
+		bound_state bound = {};
+		bound_state::skip_counters redundant_binds_skipped = {};
+		label_string label;
 		bool one_shot = false;
 
 		inline command_encoder_base(command_encoder_base&& o) { *this = std::move(o); }
 		inline command_encoder_base& operator=(command_encoder_base&& o) {
 			deferred_to_release = std::move(o.deferred_to_release);
-			pre_encoder = std::exchange(o.pre_encoder, nullptr);
-			compute_encoder = std::exchange(o.compute_encoder, nullptr);
+			encoder = std::exchange(o.encoder, nullptr);
 			compute_pass = std::exchange(o.compute_pass, nullptr);
-			label = std::move(o.label);
+			bound = std::exchange(o.bound, {});
+			redundant_binds_skipped = std::exchange(o.redundant_binds_skipped, {});
+			label = o.label;
 			one_shot = o.one_shot;
 			return *this;
 		}
-		inline operator bool() const override { return pre_encoder || compute_encoder || compute_pass; }
+		inline operator bool() const override { return encoder || compute_pass; }
 		Twebgpu_return&& move() { return std::move(*(Twebgpu_return*)this); }
 
 		static Twebgpu_return create(api::device& device, bool one_shot = false, const std::string_view label = "Stylizer Command Encoder");
 
 		template<typename Tfunc>
-		Twebgpu_return& defer(Tfunc&& func) { deferred_to_release->connect(std::move(func)); return *(Twebgpu_return*)this; }
-		Tapi_return& defer(std::function<void()>&& func) override { deferred_to_release->connect(std::move(func)); return *(Tapi_return*)this; }
+		Twebgpu_return& defer(Tfunc&& func) { deferred_to_release.push(std::forward<Tfunc>(func)); return *(Twebgpu_return*)this; }
+		Tapi_return& defer(stylizer::deferred_action&& func) override { deferred_to_release.push(std::move(func)); return *(Tapi_return*)this; }
 
 	protected:
-		WGPUCommandEncoder maybe_create_pre_encoder(webgpu::device& device);
+		WGPUCommandEncoder maybe_create_encoder(webgpu::device& device);
+		// Returns the encoder with no pass open (for copies and the like)
+		WGPUCommandEncoder maybe_end_passes(webgpu::device& device);
 		WGPUComputePassEncoder maybe_create_compute_pass(webgpu::device& device);
+		void end_compute_pass();
+		void end_render_pass() {} // Hidden by render_pass
+		webgpu::command_buffer finish();
 	public:
 
 		Tapi_return& copy_buffer_to_buffer(api::device& device, api::buffer& destination, const api::buffer& source, std::optional<size_t> destination_offset = 0, std::optional<size_t> source_offset = 0, std::optional<size_t> size_override = {}) override;
@@ -253,14 +338,17 @@ namespace stylizer::api::webgpu {
 		Tapi_return& bind_compute_pipeline(api::device& device, const api::compute_pipeline& pipeline, bool release_on_submit = false) override;
 		Tapi_return& bind_compute_group(api::device& device, const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) override;
 		Tapi_return& dispatch_workgroups(api::device& device, vec3u workgroups) override;
+		Tapi_return& dispatch_workgroups_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override;
+
+		Tapi_return& begin_compute_pass(api::device& device) override;
+		Tapi_return& end_pass(api::device& device) override;
 
 		webgpu::command_buffer end(api::device& device);
 		api::command_buffer& end(temporary_return_t, api::device& device) override {
-			static command_buffer buffer;
-			return buffer = end(device);
+			return temporary_storage(end(device));
 		}
 
-		void one_shot_submit(api::device& device) override;
+		uint64_t one_shot_submit(api::device& device) override;
 
 		void release() override;
 	};
@@ -283,27 +371,30 @@ namespace stylizer::api::webgpu {
 		using super = webgpu::command_encoder_base<api::render_pass, render_pass>;
 
 		// NOTE: Type gets inherited from command_encoder
-		WGPUCommandEncoder render_encoder = nullptr;
 		WGPURenderPassEncoder pass = nullptr;
 		std::vector<color_attachment> color_attachments = {};
 		std::optional<depth_stencil_attachment> depth_attachment = {};
-		bool render_used = false;
+		bool pass_begun = false; // Once the pass has been interrupted it must be resumed by loading what was stored
+		bound_state interrupted_state = {}; // What was bound when the pass was interrupted, rebound when it resumes
 
 		inline render_pass(std::vector<color_attachment> colors, std::optional<depth_stencil_attachment> depth): color_attachments(std::move(colors)), depth_attachment(depth) {}
 		inline render_pass(render_pass&& o) { *this = std::move(o); }
 		inline render_pass& operator=(render_pass&& o) {
 			super::operator=(std::move(o));
-			render_encoder = std::exchange(o.render_encoder, nullptr);
 			pass = std::exchange(o.pass, nullptr);
 			color_attachments = std::exchange(o.color_attachments, {});
 			depth_attachment = std::exchange(o.depth_attachment, {});
-			render_used = std::exchange(o.render_used, false);
+			pass_begun = std::exchange(o.pass_begun, false);
+			interrupted_state = std::exchange(o.interrupted_state, {});
 			return *this;
 		}
-		inline operator bool() const override { return super::operator bool() || render_encoder || pass; }
+		inline operator bool() const override { return super::operator bool() || pass; }
 
 		static render_pass create(api::device& device, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass");
 
+		api::render_pass& begin_render_pass(api::device& device, std::span<const render_pass::color_attachment> colors, const std::optional<depth_stencil_attachment>& depth = {}) override;
+		api::render_pass& end_pass(api::device& device) override;
+
 		api::render_pass& bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline, bool release_on_submit =  false) override;
 		api::render_pass& bind_render_group(api::device& device, const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) override;
 		api::render_pass& bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override;
@@ -311,11 +402,21 @@ namespace stylizer::api::webgpu {
 
 		api::render_pass& draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) override;
 		api::render_pass& draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) override;
+		api::render_pass& draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override;
+		api::render_pass& draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override;
+
+		api::render_pass& execute_bundles(api::device& device, std::span<const api::render_bundle* const> bundles) override;
+
+	protected:
+		friend super;
+		WGPURenderPassEncoder maybe_begin_render_pass(webgpu::device& device);
+		void end_render_pass();
+	public:
 
 		webgpu::command_buffer end(api::device& device);
 		api::command_buffer& end(temporary_return_t, api::device& device) override;
 
-		void one_shot_submit(api::device& device) override;
+		uint64_t one_shot_submit(api::device& device) override;
 
 		void release() override;
 		stylizer::auto_release<render_pass> auto_release() { return std::move(*this); }
@@ -326,8 +427,8 @@ namespace stylizer::api::webgpu {
 		uint32_t type = magic_number;
 		WGPURenderPipeline pipeline = nullptr;
 
-		render_pipeline(render_pipeline&& o) { *this = std::move(o); }
-		render_pipeline& operator=(render_pipeline&& o) {
+		render_pipeline(render_pipeline&& o) noexcept { *this = std::move(o); }
+		render_pipeline& operator=(render_pipeline&& o) noexcept {
 			pipeline = std::exchange(o.pipeline, nullptr);
 			return *this;
 		}
@@ -344,9 +445,49 @@ namespace stylizer::api::webgpu {
 	};
 	static_assert(render_pipeline_concept<render_pipeline>);
 
+	struct render_bundle : public api::render_bundle { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(render_bundle); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(render_bundle);
+		uint32_t type = magic_number;
+		WGPURenderBundleEncoder encoder = nullptr; // Only valid while recording
+		WGPURenderBundle bundle = nullptr; // Only valid once finished
+		bound_state bound = {};
+		bound_state::skip_counters redundant_binds_skipped = {};
+		label_string label;
+
+		render_bundle(render_bundle&& o) noexcept { *this = std::move(o); }
+		render_bundle& operator=(render_bundle&& o) noexcept {
+			encoder = std::exchange(o.encoder, nullptr);
+			bundle = std::exchange(o.bundle, nullptr);
+			bound = std::exchange(o.bound, {});
+			redundant_binds_skipped = std::exchange(o.redundant_binds_skipped, {});
+			label = o.label;
+			return *this;
+		}
+		inline operator bool() const override { return encoder || bundle; }
+		inline bool finished() const override { return bundle; }
+
+		static render_bundle create(api::device& device, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle");
+
+		api::render_bundle& bind_render_pipeline(api::device& device, const api::render_pipeline& pipeline) override;
+		api::render_bundle& bind_render_group(api::device& device, const api::bind_group& group, std::optional<size_t> index_override = {}) override;
+		api::render_bundle& bind_vertex_buffer(api::device& device, size_t slot, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override;
+		api::render_bundle& bind_index_buffer(api::device& device, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) override;
+
+		api::render_bundle& draw(api::device& device, size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) override;
+		api::render_bundle& draw_indexed(api::device& device, size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) override;
+		api::render_bundle& draw_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override;
+		api::render_bundle& draw_indexed_indirect(api::device& device, const api::buffer& indirect_buffer, size_t offset = 0) override;
+
+		api::render_bundle& finish(api::device& device) override;
+
+		void release() override;
+		stylizer::auto_release<render_bundle> auto_release() { return std::move(*this); }
+	};
+	static_assert(render_bundle_concept<render_bundle>);
+
 	namespace render {
 		using pipeline = render_pipeline;
 		using pass = render_pass;
+		using bundle = render_bundle;
 	}
 
 	struct surface : public api::surface { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(surface);  STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(surface);
@@ -374,6 +515,8 @@ namespace stylizer::api::webgpu {
 
 		webgpu::texture next_texture(api::device& device);
 		api::texture& next_texture(temporary_return_t, api::device& device) override;
+		result<webgpu::texture> try_next_texture(api::device& device);
+		result<api::texture*> try_next_texture(temporary_return_t, api::device& device) override;
 
 		texture::format configured_texture_format(api::device& device) override;
 
@@ -384,25 +527,107 @@ namespace stylizer::api::webgpu {
 	};
 	static_assert(surface_concept<surface>);
 
+	// Implementation in device.cpp
+	struct submission_tracker;
+	// Implementation in common.hpp
+	struct device_caches;
+
+	// Slot maps backing the device's handle based ownership (one per object type)
+	struct object_registry {
+		std::tuple<
+			stylizer::slot_map<texture>,
+			stylizer::slot_map<texture_view>,
+			stylizer::slot_map<buffer>,
+			stylizer::slot_map<shader>,
+			stylizer::slot_map<bind_group>,
+			stylizer::slot_map<compute_pipeline>,
+			stylizer::slot_map<render_pipeline>
+		> maps;
+
+		template<typename T>
+		stylizer::slot_map<T>& get() { return std::get<stylizer::slot_map<T>>(maps); }
+
+		~object_registry() {
+			std::apply([](auto&... maps) {
+				([&] { for (auto& object: maps) object.release(); }(), ...);
+			}, maps);
+		}
+	};
+
 	struct device : public api::device { STYLIZER_API_GENERIC_AUTO_RELEASE_SUPPORT(device); STYLIZER_API_MOVE_TEMPORARY_TO_HEAP_DERIVED_METHOD(device);
 		uint32_t type = magic_number;
 		WGPUAdapter adapter = nullptr;
 		WGPUDevice device_ = nullptr;
 		WGPUQueue queue = nullptr;
+		enum wait_strategy wait_strategy = wait_strategy::Block;
+		std::chrono::nanoseconds wait_spin_duration = {}, wait_sleep_interval = {};
+		enum feature enabled_features = feature::None;
+		std::shared_ptr<submission_tracker> submissions; // Shared since in flight callbacks may outlive the device
+		std::shared_ptr<device_caches> caches;
+		std::shared_ptr<object_registry> objects;
 
 		inline device(device&& o) { *this = std::move(o); }
 		inline device& operator=(device&& o) {
 			adapter = std::exchange(o.adapter, nullptr);
 			device_ = std::exchange(o.device_, nullptr);
 			queue = std::exchange(o.queue, nullptr);
+			wait_strategy = o.wait_strategy;
+			wait_spin_duration = o.wait_spin_duration;
+			wait_sleep_interval = o.wait_sleep_interval;
+			enabled_features = std::exchange(o.enabled_features, feature::None);
+			submissions = std::move(o.submissions);
+			caches = std::move(o.caches);
+			objects = std::move(o.objects);
 			return *this;
 		}
 		inline operator bool() const override { return adapter || device_; }
 
 		static webgpu::device create_default(const webgpu::device::create_config& config = {});
+		static result<webgpu::device> try_create_default(const webgpu::device::create_config& config = {});
+		// NOTE: Labels, the adapter preference and the cache directory are copied, but the compatible surface (if any) must stay alive until the future is ready
+		// NOTE: Device creation runs on a worker thread, so any errors are reported to the error handler from that thread (and rethrown by future::get)
+		static std::future<webgpu::device> create_default_async(const webgpu::device::create_config& config = {});
 
 		bool process_events();
-		bool tick(bool wait_for_queues = true) override;
+		bool poll() override;
+		bool tick(bool wait_for_queues = true, std::optional<std::chrono::nanoseconds> timeout = {}) override;
+		// Waits for the future using the device's wait strategy, returns false if the timeout expired first
+		bool wait(WGPUFuture future, std::optional<std::chrono::nanoseconds> timeout = {});
+
+		// Submits the command buffers to the queue and returns the serial of the submission
+		uint64_t submit(std::span<const WGPUCommandBuffer> commands);
+		result<uint64_t> try_submit(std::span<const WGPUCommandBuffer> commands);
+		uint64_t completed_serial() const override;
+		bool wait(uint64_t serial, std::optional<std::chrono::nanoseconds> timeout = {}) override;
+		api::device& on_completed(uint64_t serial, std::function<void()>&& callback) override;
+
+		adapter_info get_adapter_info() const override;
+		result<adapter_info> try_get_adapter_info() const;
+
+		device_limits limits() const override;
+
+		enum feature features() const override { return enabled_features; }
+		bool is_lost() const override;
+
+		// Optional handle based ownership: the device takes the object and hands back a 32-bit generational handle
+		// NOTE: Pointers returned by lookup are invalidated by the next make_handle or release_handle of the same type
+		// NOTE: Registering a texture moves it, views created from it beforehand (other than its full_view) then dangle
+		// NOTE: Not thread safe, access must be externally synchronized
+		template<typename T>
+		stylizer::handle<std::remove_cvref_t<T>> make_handle(T&& object) requires(!std::is_lvalue_reference_v<T>) {
+			return objects->get<std::remove_cvref_t<T>>().insert(std::move(object));
+		}
+		template<typename T>
+		T* lookup(stylizer::handle<T> handle) { return objects->get<T>().get(handle); }
+		template<typename T>
+		bool is_valid(stylizer::handle<T> handle) const { return objects && objects->get<T>().contains(handle); }
+		// Releases the object, returns false if the handle was no longer valid
+		template<typename T>
+		bool release_handle(stylizer::handle<T> handle) {
+			auto object = objects->get<T>().erase(handle);
+			if (object) object->release();
+			return object.has_value();
+		}
 
 		webgpu::texture create_texture(const api::texture::create_config& config = {});
 		api::texture& create_texture(temporary_return_t, const api::texture::create_config& config = {}) override;
@@ -435,6 +660,9 @@ namespace stylizer::api::webgpu {
 		webgpu::render_pass create_render_pass(std::span<const api::render_pass::color_attachment> colors, std::optional<api::render_pass::depth_stencil_attachment> depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass");
 		api::render_pass& create_render_pass(temporary_return_t, std::span<const api::render_pass::color_attachment> colors, const std::optional<api::render_pass::depth_stencil_attachment>& depth = {}, bool one_shot = false, const std::string_view label = "Stylizer Render Pass") override;
 
+		webgpu::render_pass create_command_recorder(bool one_shot = false, const std::string_view label = "Stylizer Command Recorder");
+		api::render_pass& create_command_recorder(temporary_return_t, bool one_shot = false, const std::string_view label = "Stylizer Command Recorder") override;
+
 		webgpu::compute_pipeline create_compute_pipeline(const pipeline::entry_point& entry_point, const std::string_view label = "Stylizer Compute Pipeline");
 		api::compute_pipeline& create_compute_pipeline(temporary_return_t, const pipeline::entry_point& entry_point, const std::string_view label = "Stylizer Compute Pipeline") override;
 
@@ -443,7 +671,17 @@ namespace stylizer::api::webgpu {
 		webgpu::render_pipeline create_render_pipeline_from_compatible_render_pass(const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline");
 		api::render_pipeline& create_render_pipeline_from_compatible_render_pass(temporary_return_t, const pipeline::entry_points& entry_points, const api::render_pass& compatible_render_pass, const api::render_pipeline::config& config = {}, const std::string_view label = "Stylizer Render Pipeline") override;
 
-		void release(bool static_sub_objects = false) override;
+		webgpu::render_bundle create_render_bundle(std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle");
+		api::render_bundle& create_render_bundle(temporary_return_t, std::span<const color_attachment> color_attachments, const std::optional<depth_stencil_attachment>& depth_attachment = {}, const std::string_view label = "Stylizer Render Bundle") override;
+
+		void release() override;
 		stylizer::auto_release<device> auto_release() { return std::move(*this); }
 	};
+
+	struct backend {
+		using device = webgpu::device;
+		using command_encoder = webgpu::command_encoder;
+		using render_pass = webgpu::render_pass;
+	};
+	static_assert(backend_concept<backend>);
 } // namespace stylizer::api::stub
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "api.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace stylizer::api {
+
+	/**
+	* @brief Limits how many frames the CPU may record ahead of the GPU.
+	*
+	* Each frame occupies one of frames_in_flight slots. Before a slot is reused the submission which last used it must have
+	* finished on the GPU, so per frame resources can be rotated with frame_index() without any further synchronization.
+	*
+	* @code
+	*   stylizer::api::frame_pacer pacer(device, {.frames_in_flight = 2});
+	*   while (running) {
+	*       if (!pacer.begin_frame()) continue; // Only happens with the Skip policy (or a timeout)
+	*       auto& per_frame = resources[pacer.frame_index()];
+	*       pacer.end_frame(encoder.one_shot_submit(device));
+	*   }
+	* @endcode
+	*/
+	struct frame_pacer {
+		enum class policy {
+			Block, // Wait for the GPU to catch up before starting a new frame
+			Skip, // Don't start a new frame until the GPU has caught up (begin_frame returns false)
+		};
+
+		struct config {
+			size_t frames_in_flight = 2;
+			enum policy policy = policy::Block;
+			std::optional<std::chrono::nanoseconds> timeout = {}; // Maximum time the Block policy will wait before skipping the frame
+		};
+
+		using clock = std::chrono::steady_clock;
+
+		api::device* device = nullptr;
+		enum policy policy = policy::Block;
+		std::optional<std::chrono::nanoseconds> timeout = {};
+		std::vector<uint64_t> serials = {}; // Serial of the last submission made by each slot
+		std::vector<clock::time_point> submitted_at = {};
+		size_t frame_number = 0;
+		std::chrono::nanoseconds last_cpu_ahead_time = {};
+		std::chrono::nanoseconds last_wait_time = {};
+
+		frame_pacer() {}
+		frame_pacer(api::device& device, const config& config = {})
+			: device(&device), policy(config.policy), timeout(config.timeout), serials(std::max<size_t>(config.frames_in_flight, 1), 0), submitted_at(serials.size()) {}
+
+		// Returns false if the frame should be skipped, in which case end_frame must not be called
+		bool begin_frame() {
+			assert(device);
+			auto now = clock::now();
+			auto serial = serials[frame_index()];
+			if (serial == 0 || device->completed_serial() >= serial) {
+				last_cpu_ahead_time = {};
+				last_wait_time = {};
+				return true;
+			}
+
+			// How long ago (as of now, not as of any submission) the frame we are about to wait on was ended
+			last_cpu_ahead_time = now - submitted_at[frame_index()];
+			if (policy == policy::Skip) {
+				device->poll();
+				return device->completed_serial() >= serial;
+			}
+
+			bool done = device->wait(serial, timeout);
+			last_wait_time = clock::now() - now;
+			return done;
+		}
+
+		// The serial of the frame's final submission
+		void end_frame(uint64_t serial) {
+			serials[frame_index()] = serial;
+			submitted_at[frame_index()] = clock::now();
+			++frame_number;
+		}
+
+		size_t frame_index() const { return frame_number % serials.size(); }
+
+		size_t frames_in_flight() const { return serials.size(); }
+
+		// Number of submitted frames the GPU has not finished yet
+		size_t pending_frames() const {
+			assert(device); // Default constructed pacers have no device to query
+			auto completed = device->completed_serial();
+			size_t out = 0;
+			for (auto serial : serials)
+				if (serial > completed) ++out;
+			return out;
+		}
+
+		// Measured in begin_frame when the slot's previous frame hadn't finished yet: the time between that frame's
+		// end_frame and this begin_frame (zero if the previous frame had already finished). It is a lower bound on how
+		// far the CPU is running ahead of the GPU, not the latency of any individual submission.
+		std::chrono::nanoseconds cpu_ahead_time() const { return last_cpu_ahead_time; }
+
+		// How long the last begin_frame blocked for
+		std::chrono::nanoseconds wait_time() const { return last_wait_time; }
+	};
+}
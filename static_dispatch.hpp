@@ -0,0 +1,148 @@
+#pragma once
+
+#include "api.hpp"
+
+namespace stylizer::api {
+
+	/**
+	* @brief Encoding front ends which call a backend's concrete methods directly instead of going through the vtable.
+	*
+	* When the backend is known at compile time (see `STYLIZER_CURRENT_BACKEND`) every bind, draw and dispatch is
+	* resolved statically, which removes the virtual dispatch (an indirect call) per command. The backend's methods are
+	* still defined out of line, so each command remains a regular call unless link time optimization inlines it.
+	* The wrappers don't own anything, they simply remember the device and encoder they forward to.
+	*
+	* @code
+	*   stylizer::api::static_device<stylizer::api::webgpu::backend> fast{device};
+	*   auto pass = fast.encode(render_pass);
+	*   for (auto& object : objects)
+	*       pass.bind_vertex_buffer(0, object.vertices).bind_index_buffer(object.indices).draw_indexed(object.index_count);
+	*   pass.one_shot_submit();
+	* @endcode
+	*/
+	template<backend_concept Backend, typename Tencoder, typename Tself>
+	struct static_encoder_base {
+		using device_t = typename Backend::device;
+		using encoder_t = Tencoder;
+
+		device_t& device;
+		encoder_t& encoder;
+
+		Tself& copy_buffer_to_buffer(api::buffer& destination, const api::buffer& source, std::optional<size_t> destination_offset = 0, std::optional<size_t> source_offset = 0, std::optional<size_t> size_override = {}) {
+			encoder.encoder_t::copy_buffer_to_buffer(device, destination, source, destination_offset, source_offset, size_override);
+			return self();
+		}
+		Tself& copy_buffer_to_texture(api::buffer& destination, const api::texture& source, std::optional<size_t> destination_offset = 0, std::optional<vec3u> source_origin = { { 0, 0, 0 } }, std::optional<vec3u> extent_override = {}, std::optional<size_t> min_mip_level = 0, std::optional<size_t> mip_levels_override = {}) {
+			encoder.encoder_t::copy_buffer_to_texture(device, destination, source, destination_offset, source_origin, extent_override, min_mip_level, mip_levels_override);
+			return self();
+		}
+		Tself& copy_texture_to_buffer(api::texture& destination, const api::buffer& source, std::optional<vec3u> destination_origin = { { 0, 0, 0 } }, std::optional<size_t> source_offset = 0, std::optional<vec3u> extent_override = {}, std::optional<size_t> min_mip_level = 0, std::optional<size_t> mip_levels_override = {}) {
+			encoder.encoder_t::copy_texture_to_buffer(device, destination, source, destination_origin, source_offset, extent_override, min_mip_level, mip_levels_override);
+			return self();
+		}
+		Tself& copy_texture_to_texture(api::texture& destination, const api::texture& source, std::optional<vec3u> destination_origin = { { 0, 0, 0 } }, std::optional<vec3u> source_origin = { { 0, 0, 0 } }, std::optional<vec3u> extent_override = {}, std::optional<size_t> min_mip_level = 0, std::optional<size_t> mip_levels_override = {}) {
+			encoder.encoder_t::copy_texture_to_texture(device, destination, source, destination_origin, source_origin, extent_override, min_mip_level, mip_levels_override);
+			return self();
+		}
+
+		Tself& bind_compute_pipeline(const api::compute_pipeline& pipeline, bool release_on_submit = false) {
+			encoder.encoder_t::bind_compute_pipeline(device, pipeline, release_on_submit);
+			return self();
+		}
+		Tself& bind_compute_group(const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) {
+			encoder.encoder_t::bind_compute_group(device, group, release_on_submit, index_override);
+			return self();
+		}
+		Tself& dispatch_workgroups(vec3u workgroups) {
+			encoder.encoder_t::dispatch_workgroups(device, workgroups);
+			return self();
+		}
+		Tself& dispatch_workgroups_indirect(const api::buffer& indirect_buffer, size_t offset = 0) {
+			encoder.encoder_t::dispatch_workgroups_indirect(device, indirect_buffer, offset);
+			return self();
+		}
+
+		Tself& begin_compute_pass() {
+			encoder.encoder_t::begin_compute_pass(device);
+			return self();
+		}
+		Tself& end_pass() {
+			encoder.encoder_t::end_pass(device);
+			return self();
+		}
+
+		auto end() { return encoder.encoder_t::end(device); }
+		uint64_t one_shot_submit() { return encoder.encoder_t::one_shot_submit(device); }
+
+	protected:
+		Tself& self() { return *static_cast<Tself*>(this); }
+	};
+
+	template<backend_concept Backend>
+	struct static_command_encoder : public static_encoder_base<Backend, typename Backend::command_encoder, static_command_encoder<Backend>> {};
+
+	template<backend_concept Backend>
+	struct static_render_pass : public static_encoder_base<Backend, typename Backend::render_pass, static_render_pass<Backend>> {
+		using super = static_encoder_base<Backend, typename Backend::render_pass, static_render_pass<Backend>>;
+		using typename super::encoder_t;
+		using super::device;
+		using super::encoder;
+
+		static_render_pass& begin_render_pass(std::span<const api::color_attachment> colors, const std::optional<api::depth_stencil_attachment>& depth = {}) {
+			encoder.encoder_t::begin_render_pass(device, colors, depth);
+			return *this;
+		}
+
+		static_render_pass& bind_render_pipeline(const api::render_pipeline& pipeline, bool release_on_submit = false) {
+			encoder.encoder_t::bind_render_pipeline(device, pipeline, release_on_submit);
+			return *this;
+		}
+		static_render_pass& bind_render_group(const api::bind_group& group, std::optional<bool> release_on_submit = false, std::optional<size_t> index_override = {}) {
+			encoder.encoder_t::bind_render_group(device, group, release_on_submit, index_override);
+			return *this;
+		}
+		static_render_pass& bind_vertex_buffer(size_t slot, const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) {
+			encoder.encoder_t::bind_vertex_buffer(device, slot, buffer, offset, size_override);
+			return *this;
+		}
+		static_render_pass& bind_index_buffer(const api::buffer& buffer, std::optional<size_t> offset = 0, std::optional<size_t> size_override = {}) {
+			encoder.encoder_t::bind_index_buffer(device, buffer, offset, size_override);
+			return *this;
+		}
+
+		static_render_pass& draw(size_t vertex_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_vertex = 0, size_t first_instance = 0) {
+			encoder.encoder_t::draw(device, vertex_count, instance_count, first_vertex, first_instance);
+			return *this;
+		}
+		static_render_pass& draw_indexed(size_t index_count, std::optional<size_t> instance_count = 1, std::optional<size_t> first_index = 0, std::optional<size_t> base_vertex = 0, size_t first_instance = 0) {
+			encoder.encoder_t::draw_indexed(device, index_count, instance_count, first_index, base_vertex, first_instance);
+			return *this;
+		}
+		static_render_pass& draw_indirect(const api::buffer& indirect_buffer, size_t offset = 0) {
+			encoder.encoder_t::draw_indirect(device, indirect_buffer, offset);
+			return *this;
+		}
+		static_render_pass& draw_indexed_indirect(const api::buffer& indirect_buffer, size_t offset = 0) {
+			encoder.encoder_t::draw_indexed_indirect(device, indirect_buffer, offset);
+			return *this;
+		}
+
+		static_render_pass& execute_bundles(std::span<const api::render_bundle* const> bundles) {
+			encoder.encoder_t::execute_bundles(device, bundles);
+			return *this;
+		}
+	};
+
+	template<backend_concept Backend>
+	struct static_device {
+		using device_t = typename Backend::device;
+
+		device_t& device;
+
+		static_command_encoder<Backend> encode(typename Backend::command_encoder& encoder) { return {{device, encoder}}; }
+		static_render_pass<Backend> encode(typename Backend::render_pass& pass) { return {{device, pass}}; }
+
+		device_t* operator->() { return &device; }
+		operator device_t&() { return device; }
+	};
+}
@@ -1,4 +1,5 @@
 #include "sdl3.hpp"
+#include "frame_pacer.hpp"
 #include <backends/current_backend.hpp>
 
 #include <GL/gl.h>
@@ -137,21 +138,23 @@ float4 fragment(float4 : SV_Position) : SV_Target {
 		color_attachments
 	);
 
+	stylizer::api::frame_pacer pacer(device, {.frames_in_flight = 2});
 	bool should_close = false;
 	while (!should_close) {
 		for (SDL_Event event; SDL_PollEvent(&event);) switch (event.type) {
 		break; case SDL_EVENT_QUIT:
 			should_close = true;
 		}
-		device.process_events();
+		device.poll();
+		if (!pacer.begin_frame()) continue;
 
 		try {
 			stylizer::auto_release texture = surface.next_texture(device);
 			color_attachments[0].texture = &texture;
-			device.create_render_pass(color_attachments, {}, true)
+			pacer.end_frame(device.create_render_pass(color_attachments, {}, true)
 				.bind_render_pipeline(device, pipeline)
 				.draw(device, 3)
-				.one_shot_submit(device);
+				.one_shot_submit(device));
 			surface.present(device);
 		} catch(stylizer::api::surface::texture_acquisition_failed fail) {
 			std::cerr << fail.what() << std::endl;
@@ -0,0 +1,86 @@
+#include "common.hpp"
+
+#include <array>
+
+using namespace stylizer::tests;
+
+// Startup cost of the pipelines a real application hits first (device creation, the texture blit and mipmap
+// pipelines, and the demo's render pipeline from test.cpp), first with an empty (cold) pipeline cache and then again
+// with the cache the first run populated (warm)
+
+constexpr static api::texture_format format = api::texture_format::RGBAu8_Normalized;
+
+// The demo render pipeline from test.cpp
+constexpr static std::string_view demo_source = R"(
+[shader("vertex")]
+float4 vertex(uint index : SV_VertexID) : SV_Position {
+	float2 p = float2(0.0, 0.0);
+	if (index == 0) {
+		p = float2(-0.5, -0.5);
+	} else if (index == 1) {
+		p = float2(0.5, -0.5);
+	} else {
+		p = float2(0.0, 0.5);
+	}
+	return float4(p, 0.0, 1.0);
+}
+
+[shader("fragment")]
+float4 fragment(float4 : SV_Position) : SV_Target {
+    return float4(231.0/255, 39.0/255, 37.0/255, 1.0);
+})";
+
+struct startup_times {
+	double device, blit, mipmaps, demo;
+	double total() const { return device + blit + mipmaps + demo; }
+};
+
+startup_times startup(std::string_view cache_directory) {
+	startup_times out;
+	webgpu::device device;
+	out.device = time_milliseconds([&] { device = create_device(true, cache_directory); });
+
+	auto source = webgpu::texture::create(device, { .format = format, .usage = api::usage::Texture, .size = {256, 256, 1} });
+	source.configure_sampler(device);
+	auto target = webgpu::texture::create(device, { .format = format, .usage = api::usage::RenderAttachment | api::usage::Texture | api::usage::CopySource, .size = {256, 256, 1} });
+	out.blit = time_milliseconds([&] {
+		target.blit_from(device, source);
+		device.tick();
+	});
+	out.mipmaps = time_milliseconds([&] {
+		target.generate_mipmaps(device);
+		device.tick();
+	});
+
+	out.demo = time_milliseconds([&] {
+		auto vertex_shader = webgpu::shader::create_from_source(device, api::shader::language::Slang, api::shader::stage::Vertex, demo_source, "vertex");
+		auto fragment_shader = webgpu::shader::create_from_source(device, api::shader::language::Slang, api::shader::stage::Fragment, demo_source, "fragment");
+		std::array<api::color_attachment, 1> color_attachments = {api::color_attachment{ .texture_format = format }};
+		auto pipeline = webgpu::render_pipeline::create(device, {
+			{api::shader::stage::Vertex, {&vertex_shader, "vertex"}},
+			{api::shader::stage::Fragment, {&fragment_shader, "fragment"}},
+		}, color_attachments);
+		pipeline.release();
+		fragment_shader.release();
+		vertex_shader.release();
+	});
+
+	target.release();
+	source.release();
+	device.tick();
+	device.release();
+	return out;
+}
+
+int main() {
+	auto errors = print_errors();
+	temporary_directory directory("stylizer-blob-cache-bench");
+	auto cold = startup(directory.path.string());
+	auto warm = startup(directory.path.string());
+	std::printf("device: cold %.2fms, warm %.2fms\n", cold.device, warm.device);
+	std::printf("blit: cold %.2fms, warm %.2fms\n", cold.blit, warm.blit);
+	std::printf("mipmaps: cold %.2fms, warm %.2fms\n", cold.mipmaps, warm.mipmaps);
+	std::printf("demo pipeline: cold %.2fms, warm %.2fms\n", cold.demo, warm.demo);
+	std::printf("total: cold %.2fms, warm %.2fms (%.2fx)\n", cold.total(), warm.total(), cold.total() / warm.total());
+	return 0;
+}
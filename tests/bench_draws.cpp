@@ -0,0 +1,78 @@
+#include "common.hpp"
+
+#include <vector>
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+// Cost of the downcasts in a 100k draw encode loop: the RTTI free tagged downcast (confirm_webgpu_type) against
+// dynamic_cast (as<T>() when STYLIZER_NO_RTTI isn't defined), both in isolation and inside an encode loop
+
+constexpr static size_t draw_count = 100'000;
+// An indexed draw downcasts the pipeline, bind group, vertex buffer and index buffer
+constexpr static size_t downcasts_per_draw = 4;
+
+int main() {
+	auto errors = print_errors();
+	auto device = create_device(true);
+
+	std::vector<webgpu::buffer> buffers;
+	for (size_t i = 0; i < 2; ++i)
+		buffers.emplace_back(webgpu::buffer::create(device, api::usage::Vertex | api::usage::Index, 256));
+	// Go through a base reference picked at runtime so nothing can be devirtualized or folded away
+	std::vector<api::buffer*> bases = { &buffers[0], &buffers[1] };
+
+	volatile WGPUBuffer sink = nullptr;
+	auto tagged = time_milliseconds([&] {
+		for (size_t i = 0; i < draw_count * downcasts_per_draw; ++i)
+			sink = webgpu::confirm_webgpu_type<webgpu::buffer>(*bases[i % bases.size()]).buffer_;
+	});
+#ifndef STYLIZER_NO_RTTI
+	auto dynamic = time_milliseconds([&] {
+		for (size_t i = 0; i < draw_count * downcasts_per_draw; ++i)
+			sink = bases[i % bases.size()]->as<webgpu::buffer>().buffer_;
+	});
+	std::printf("%zu draws (%zu downcasts each), tagged: %.3fms, dynamic_cast: %.3fms (%.2fx)\n", draw_count, downcasts_per_draw, tagged, dynamic, dynamic / tagged);
+#else
+	std::printf("%zu draws (%zu downcasts each), tagged: %.3fms (dynamic_cast unavailable, STYLIZER_NO_RTTI is defined)\n", draw_count, downcasts_per_draw, tagged);
+#endif
+
+	// The real encode loop, alternating buffers so the redundant bind tracking can't skip anything
+	auto target = webgpu::texture::create(device, { .format = api::texture_format::RGBAu8_Normalized, .usage = api::usage::RenderAttachment, .size = {64, 64, 1} });
+	std::array<api::render_pass::color_attachment, 1> colors = {api::render_pass::color_attachment{ .texture = &target, .clear_value = api::color32{0, 0, 0, 1} }};
+	auto pass = webgpu::render_pass::create(device, colors);
+	auto encode = time_milliseconds([&] {
+		for (size_t i = 0; i < draw_count; ++i)
+			pass.bind_vertex_buffer(device, 0, *bases[i % bases.size()]).draw(device, 3);
+	});
+	std::printf("%zu draws encoded: %.3fms\n", draw_count, encode);
+
+	// The same encode loop (a vertex and index buffer bind plus an indexed draw recorded into Dawn) with only the
+	// downcast differing, so the saving is measured next to the cost of actually encoding (the pass was begun above)
+	auto encoder_pass = pass.pass;
+	auto encode_with = [&](auto&& downcast) {
+		return time_milliseconds([&] {
+			for (size_t i = 0; i < draw_count; ++i) {
+				auto& vertices = downcast(*bases[i % bases.size()]);
+				auto& indices = downcast(*bases[(i + 1) % bases.size()]);
+				wgpuRenderPassEncoderSetVertexBuffer(encoder_pass, 0, vertices.buffer_, 0, vertices.size());
+				wgpuRenderPassEncoderSetIndexBuffer(encoder_pass, indices.buffer_, WGPUIndexFormat_Uint32, 0, indices.size());
+				wgpuRenderPassEncoderDrawIndexed(encoder_pass, 3, 1, 0, 0, 0);
+			}
+		});
+	};
+	auto encode_tagged = encode_with([](api::buffer& buffer) -> webgpu::buffer& { return webgpu::confirm_webgpu_type<webgpu::buffer>(buffer); });
+#ifndef STYLIZER_NO_RTTI
+	auto encode_dynamic = encode_with([](api::buffer& buffer) -> webgpu::buffer& { return *dynamic_cast<webgpu::buffer*>(&buffer); });
+	std::printf("%zu indexed draws encoded, tagged: %.3fms, dynamic_cast: %.3fms (%.2fx)\n", draw_count, encode_tagged, encode_dynamic, encode_dynamic / encode_tagged);
+#else
+	std::printf("%zu indexed draws encoded, tagged: %.3fms\n", draw_count, encode_tagged);
+#endif
+
+	// The draws have no pipeline bound, so the pass is only encoded (never finished or submitted)
+	pass.release();
+	target.release();
+	for (auto& buffer : buffers) buffer.release();
+	device.release();
+	return 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "backends/webgpu/webgpu.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <span>
+#include <string>
+
+// Fails the test (exiting with a non-zero code) when the expression is false, unlike assert this is never compiled out
+#define STYLIZER_CHECK(expression) do {                                                              \
+		if (!(expression)) {                                                                          \
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expression);      \
+			std::exit(1);                                                                             \
+		}                                                                                             \
+	} while (false)
+
+namespace stylizer::tests {
+	namespace api = stylizer::api;
+	namespace webgpu = stylizer::api::webgpu;
+
+	constexpr static std::array<api::adapter_type, 1> null_adapter_preference = { api::adapter_type::Null };
+
+	// Prints every reported error (uncaught exceptions are what fail a test)
+	inline stylizer::auto_release<connection_raw> print_errors() {
+		return get_error_handler().connect([](error_severity severity, std::string_view message, size_t) {
+			std::fprintf(stderr, "%.*s\n", int(message.size()), message.data());
+		});
+	}
+
+	// Tests use the null adapter (always available), benchmarks prefer hardware so their numbers mean something
+	inline webgpu::device create_device(bool benchmark = false, std::string_view cache_directory = {}) {
+		return webgpu::device::create_default({
+			.adapter_preference = benchmark ? std::span<const api::adapter_type>(api::any_adapter_preference) : std::span<const api::adapter_type>(null_adapter_preference),
+			.cache_directory = cache_directory,
+			.required_features = api::feature::None,
+		});
+	}
+
+	// A fresh (empty) directory which is removed again when the test exits
+	struct temporary_directory {
+		std::filesystem::path path;
+
+		temporary_directory(std::string_view name) {
+			path = std::filesystem::temp_directory_path() / (std::string(name) + "-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+			std::filesystem::create_directories(path);
+		}
+		~temporary_directory() {
+			std::error_code error;
+			std::filesystem::remove_all(path, error);
+		}
+	};
+
+	template<typename Tfunc>
+	double time_milliseconds(Tfunc&& func) {
+		auto start = std::chrono::steady_clock::now();
+		func();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
@@ -0,0 +1,43 @@
+#include "common.hpp"
+#include "backends/webgpu/common.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace stylizer::tests;
+
+// Many writers (standing in for separate processes) racing to store the same key must never leave a torn entry behind
+int main() {
+	auto errors = print_errors();
+	temporary_directory directory("stylizer-blob-cache-test");
+	auto descriptor = webgpu::create_blob_cache_descriptor(directory.path.string());
+
+	constexpr size_t writer_count = 16, value_size = 64 * 1024;
+	std::string_view key = "shared key";
+	std::vector<std::thread> writers;
+	for (size_t i = 0; i < writer_count; ++i)
+		writers.emplace_back([&, i] {
+			std::vector<std::byte> value(value_size, std::byte(i));
+			for (size_t repeat = 0; repeat < 8; ++repeat)
+				descriptor.storeDataFunction(key.data(), key.size(), value.data(), value.size(), descriptor.functionUserdata);
+		});
+	for (auto& writer: writers) writer.join();
+
+	STYLIZER_CHECK(descriptor.loadDataFunction(key.data(), key.size(), nullptr, 0, descriptor.functionUserdata) == value_size);
+	std::vector<std::byte> loaded(value_size);
+	STYLIZER_CHECK(descriptor.loadDataFunction(key.data(), key.size(), loaded.data(), loaded.size(), descriptor.functionUserdata) == value_size);
+	for (auto byte: loaded) STYLIZER_CHECK(byte == loaded.front()); // Every byte came from the same writer
+
+	// Every temporary file was moved into place (or cleaned up)
+	size_t files = 0;
+	for (auto& entry: std::filesystem::directory_iterator(directory.path)) {
+		STYLIZER_CHECK(entry.path().extension() == ".blob");
+		++files;
+	}
+	STYLIZER_CHECK(files == 1);
+
+	// Keys are stored alongside their values so a different key never loads someone else's blob
+	std::string_view other = "other key";
+	STYLIZER_CHECK(descriptor.loadDataFunction(other.data(), other.size(), nullptr, 0, descriptor.functionUserdata) == 0);
+	return 0;
+}
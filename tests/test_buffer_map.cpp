@@ -0,0 +1,27 @@
+#include "common.hpp"
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+// Mapping waits for the map callback and reports failures instead of blocking forever
+int main() {
+	auto errors = print_errors();
+	auto device = create_device();
+
+	auto buffer = webgpu::buffer::create(device, api::usage::MapRead | api::usage::CopyDestination, 256);
+	auto mapped = buffer.try_map(device);
+	STYLIZER_CHECK(mapped.has_value() && *mapped != nullptr);
+	buffer.unmap();
+	STYLIZER_CHECK(buffer.map(device) != nullptr);
+	buffer.unmap();
+
+	// Mapping a buffer without map usage fails validation, which has to come back as an error (not a hang)
+	auto unmappable = webgpu::buffer::create(device, api::usage::Storage, 256);
+	auto failed = unmappable.try_map(device);
+	STYLIZER_CHECK(!failed.has_value());
+
+	unmappable.release();
+	buffer.release();
+	device.release();
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include "common.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+// Deferred actions run in order (across the inline slots and the overflow blocks), exactly once, and only once an
+// encoder's commands have been submitted
+int main() {
+	auto errors = print_errors();
+
+	{ // Ordering across inline slots and several overflow blocks, with both inline and heap stored callables
+		constexpr size_t count = 4 + 3 * stylizer::deferred_action_list<>::block_size + 5;
+		std::vector<size_t> order;
+		stylizer::deferred_action_list<> list;
+		for (size_t i = 0; i < count; ++i)
+			if (i % 2) list.push([&order, i] { order.push_back(i); });
+			else list.push([&order, i, padding = std::array<std::byte, 2 * stylizer::deferred_action::inline_size>{}] { order.push_back(i); });
+		STYLIZER_CHECK(list.size() == count);
+
+		auto moved = std::move(list);
+		STYLIZER_CHECK(list.empty() && moved.size() == count);
+		moved();
+		STYLIZER_CHECK(moved.empty());
+		STYLIZER_CHECK(order.size() == count);
+		for (size_t i = 0; i < count; ++i)
+			STYLIZER_CHECK(order[i] == i);
+
+		moved(); // Running an empty list does nothing
+		STYLIZER_CHECK(order.size() == count);
+	}
+
+	{ // Actions added while the list runs are kept for the next run, cleared actions never run
+		size_t ran = 0;
+		stylizer::deferred_action_list<> list;
+		list.push([&] { ++ran; list.push([&] { ++ran; }); });
+		list();
+		STYLIZER_CHECK(ran == 1 && list.size() == 1);
+		list();
+		STYLIZER_CHECK(ran == 2 && list.empty());
+
+		for (size_t i = 0; i < 32; ++i) list.push([&] { ++ran; });
+		list.clear();
+		list();
+		STYLIZER_CHECK(ran == 2);
+	}
+
+	{ // Through the null backend: deferred actions travel from the encoder to the command buffer and run on submit
+		auto device = create_device();
+		auto source = webgpu::buffer::create(device, api::usage::CopySource, 256);
+		auto destination = webgpu::buffer::create(device, api::usage::CopyDestination, 256);
+
+		constexpr size_t count = 24; // Enough to overflow the inline slots
+		std::vector<size_t> order;
+		auto encoder = webgpu::command_encoder::create(device);
+		encoder.copy_buffer_to_buffer(device, destination, source);
+		for (size_t i = 0; i < count; ++i)
+			encoder.defer([&order, i] { order.push_back(i); });
+
+		auto commands = encoder.end(device);
+		STYLIZER_CHECK(order.empty());
+		commands.submit(device);
+		STYLIZER_CHECK(order.size() == count);
+		for (size_t i = 0; i < count; ++i)
+			STYLIZER_CHECK(order[i] == i);
+
+		encoder.release();
+		destination.release();
+		source.release();
+		device.release();
+	}
+	return 0;
+}
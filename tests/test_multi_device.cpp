@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+constexpr size_t thread_count = 8;
+constexpr size_t iterations = 64;
+
+// Hammers the zero buffer cache with growing sizes, earlier references must survive later (larger) requests
+static void exercise_zero_buffers(webgpu::device& device, size_t seed) {
+	std::vector<const webgpu::buffer*> seen;
+	for (size_t i = 0; i < iterations; ++i) {
+		size_t size = 16 + ((i * 37 + seed * 101) % 4096);
+		auto& zero = webgpu::buffer::zero_buffer(device, api::usage::Storage, size);
+		STYLIZER_CHECK(zero.buffer_ != nullptr);
+		STYLIZER_CHECK(zero.size() >= size);
+		seen.push_back(&zero);
+
+		for (auto previous : seen)
+			STYLIZER_CHECK(previous->buffer_ != nullptr && previous->size() >= 16);
+	}
+}
+
+// Zero buffers and submissions from many threads, both on one shared device and on one device per thread
+int main() {
+	auto errors = print_errors();
+
+	{
+		auto device = create_device();
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < thread_count; ++i)
+			threads.emplace_back([&device, i] { exercise_zero_buffers(device, i); });
+		for (auto& thread : threads) thread.join();
+
+		// The same request has to keep handing out the same buffer
+		auto& first = webgpu::buffer::zero_buffer(device, api::usage::Storage, 1024);
+		auto& second = webgpu::buffer::zero_buffer(device, api::usage::Storage, 1024);
+		STYLIZER_CHECK(&first == &second);
+		device.release();
+	}
+
+	{
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < thread_count; ++i)
+			threads.emplace_back([i] {
+				auto device = create_device();
+				exercise_zero_buffers(device, i);
+
+				// Blits go through the (per device) blit shader and pipeline caches
+				webgpu::texture::create_config config = { .usage = api::usage::Texture | api::usage::RenderAttachment, .size = {64, 64, 1} };
+				auto source = webgpu::texture::create(device, config);
+				auto destination = webgpu::texture::create(device, config);
+				destination.blit_from(device, source);
+				destination.release();
+				source.release();
+				device.tick(true);
+				device.release();
+			});
+		for (auto& thread : threads) thread.join();
+	}
+	return 0;
+}
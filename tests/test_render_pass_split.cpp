@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+// Copies and compute work recorded between draws split the render pass, the resumed pass must still have everything
+// that was bound before the split
+int main() {
+	auto errors = print_errors();
+	auto device = create_device();
+
+	auto target = webgpu::texture::create(device, { .format = api::texture_format::RGBAu8_Normalized, .usage = api::usage::RenderAttachment, .size = {16, 16, 1} });
+	auto vertices = webgpu::buffer::create(device, api::usage::Vertex, 256);
+	auto indices = webgpu::buffer::create(device, api::usage::Index, 256);
+	auto source = webgpu::buffer::create(device, api::usage::CopySource, 256);
+	auto destination = webgpu::buffer::create(device, api::usage::CopyDestination, 256);
+
+	std::array<api::render_pass::color_attachment, 1> colors = {api::render_pass::color_attachment{ .texture = &target, .clear_value = api::color32{0, 0, 0, 1} }};
+	auto pass = webgpu::render_pass::create(device, colors);
+	pass.bind_vertex_buffer(device, 0, vertices, 0, 64);
+	pass.bind_index_buffer(device, indices);
+	auto before = pass.bound;
+
+	pass.copy_buffer_to_buffer(device, destination, source); // Splits the pass
+	STYLIZER_CHECK(pass.pass == nullptr);
+
+	// Any render command resumes the pass with the same state bound
+	pass.bind_vertex_buffer(device, 1, vertices);
+	STYLIZER_CHECK(pass.pass != nullptr);
+	STYLIZER_CHECK(pass.bound.vertex_buffers[0] == before.vertex_buffers[0]);
+	STYLIZER_CHECK(pass.bound.index_buffer == before.index_buffer);
+	STYLIZER_CHECK(pass.bound.vertex_buffers[1].buffer == vertices.buffer_);
+
+	// Rebinding what was replayed is still skipped as redundant
+	auto skipped = pass.redundant_binds_skipped.vertex_buffers;
+	pass.bind_vertex_buffer(device, 0, vertices, 0, 64);
+	STYLIZER_CHECK(pass.redundant_binds_skipped.vertex_buffers == skipped + 1);
+
+	// Explicitly ending the pass forgets both the state and the attachments
+	pass.end_pass(device);
+	STYLIZER_CHECK(pass.color_attachments.empty() && pass.interrupted_state.vertex_buffers[0].buffer == nullptr);
+
+	auto commands = pass.end(device);
+	commands.submit(device);
+	pass.release();
+	for (auto buffer : {&vertices, &indices, &source, &destination}) buffer->release();
+	target.release();
+	device.release();
+	return 0;
+}
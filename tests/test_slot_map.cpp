@@ -0,0 +1,52 @@
+#include "common.hpp"
+
+#include <vector>
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+constexpr size_t texture_count = 100;
+
+// Textures registered with the device are relocated whenever the slot map grows or fills a hole, their cached full
+// view has to follow them (instead of pointing at where the texture used to live)
+int main() {
+	auto errors = print_errors();
+	auto device = create_device();
+
+	auto check = [&](stylizer::handle<webgpu::texture> handle, WGPUTextureView expected) {
+		auto texture = device.lookup(handle);
+		STYLIZER_CHECK(texture != nullptr);
+		auto& view = static_cast<const webgpu::texture_view&>(texture->full_view(device));
+		STYLIZER_CHECK(&view.texture() == texture);
+		STYLIZER_CHECK(view.view == expected); // The existing view moved along, it wasn't recreated
+	};
+
+	std::vector<stylizer::handle<webgpu::texture>> handles;
+	std::vector<WGPUTextureView> views;
+	for (size_t i = 0; i < texture_count; ++i) {
+		auto texture = webgpu::texture::create(device, { .usage = api::usage::Texture, .size = {4, 4, 1} });
+		views.push_back(static_cast<const webgpu::texture_view&>(texture.full_view(device)).view);
+		handles.push_back(device.make_handle(std::move(texture)));
+	}
+	for (size_t i = 0; i < texture_count; ++i)
+		check(handles[i], views[i]);
+
+	// Erasing swaps the last texture into the hole
+	for (size_t i = 0; i < texture_count; i += 3)
+		STYLIZER_CHECK(device.release_handle(handles[i]));
+	for (size_t i = 0; i < texture_count; ++i)
+		if (i % 3 == 0) STYLIZER_CHECK(device.lookup(handles[i]) == nullptr);
+		else check(handles[i], views[i]);
+
+	// Refill the holes, the survivors get relocated again
+	for (size_t i = 0; i < texture_count; i += 3) {
+		auto texture = webgpu::texture::create(device, { .usage = api::usage::Texture, .size = {4, 4, 1} });
+		views[i] = static_cast<const webgpu::texture_view&>(texture.full_view(device)).view;
+		handles[i] = device.make_handle(std::move(texture));
+	}
+	for (size_t i = 0; i < texture_count; ++i)
+		check(handles[i], views[i]);
+
+	device.release();
+	return 0;
+}
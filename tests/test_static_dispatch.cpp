@@ -0,0 +1,44 @@
+#include "common.hpp"
+#include "static_dispatch.hpp"
+
+using namespace stylizer::tests;
+using namespace stylizer::api::operators;
+
+// Explicitly instantiate every wrapper (and thus every forwarding method) against the webgpu backend, since templates
+// which are never instantiated are never compiled
+template struct stylizer::api::static_encoder_base<webgpu::backend, webgpu::command_encoder, stylizer::api::static_command_encoder<webgpu::backend>>;
+template struct stylizer::api::static_encoder_base<webgpu::backend, webgpu::render_pass, stylizer::api::static_render_pass<webgpu::backend>>;
+template struct stylizer::api::static_command_encoder<webgpu::backend>;
+template struct stylizer::api::static_render_pass<webgpu::backend>;
+template struct stylizer::api::static_device<webgpu::backend>;
+
+// Commands recorded through the static front end end up in the same encoder as the virtual ones
+int main() {
+	auto errors = print_errors();
+	auto device = create_device();
+	stylizer::api::static_device<webgpu::backend> fast{device};
+
+	auto source = webgpu::buffer::create(device, api::usage::CopySource | api::usage::Vertex, 256);
+	auto destination = webgpu::buffer::create(device, api::usage::CopyDestination, 256);
+	auto target = webgpu::texture::create(device, { .format = api::texture_format::RGBAu8_Normalized, .usage = api::usage::RenderAttachment, .size = {16, 16, 1} });
+
+	auto encoder = webgpu::command_encoder::create(device);
+	fast.encode(encoder).copy_buffer_to_buffer(destination, source).end_pass();
+	STYLIZER_CHECK(encoder.encoder != nullptr);
+	encoder.end(device).submit(device);
+	encoder.release();
+
+	std::array<api::render_pass::color_attachment, 1> colors = {api::render_pass::color_attachment{ .texture = &target, .clear_value = api::color32{0, 0, 0, 1} }};
+	auto recorder = webgpu::render_pass::create(device, {});
+	auto pass = fast.encode(recorder);
+	pass.begin_render_pass(colors).bind_vertex_buffer(0, source);
+	STYLIZER_CHECK(recorder.pass != nullptr && recorder.bound.vertex_buffers[0].buffer == source.buffer_);
+	pass.end_pass().end().submit(device);
+	recorder.release();
+
+	target.release();
+	destination.release();
+	source.release();
+	device.release();
+	return 0;
+}
@@ -0,0 +1,96 @@
+#include "common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace stylizer::tests;
+
+constexpr size_t thread_count = 16;
+constexpr size_t iterations = 200;
+// How many temporaries of each type a thread keeps alive at once, must stay below the ring size
+constexpr size_t window = STYLIZER_API_TEMPORARY_RING_SIZE / 2;
+
+constexpr std::string_view shader_source = R"(
+@group(0) @binding(0) var<storage, read_write> data: array<u32>;
+@compute @workgroup_size(1) fn main() { data[0] = 1u; }
+)";
+
+// Every creation gets its own label, buffer size and texture extent, so seeing the expected size on an object
+// proves it is still the object created with the matching label
+size_t buffer_size(size_t thread, size_t i) { return (thread * iterations + i + 1) * 4; }
+api::vec3u texture_size(size_t thread, size_t i) { return { thread + 1, i % 64 + 1, 1 }; }
+std::string label(std::string_view type, size_t thread, size_t i) { return std::string(type) + " " + std::to_string(thread) + "-" + std::to_string(i); }
+
+// Temporaries live in per-thread rings, so threads sharing one device never see each other's temporaries and the
+// newest temporaries of a thread all stay intact while other threads keep creating more
+int main() {
+	auto errors = print_errors();
+	auto device = create_device();
+	auto shader = webgpu::shader::create_from_wgsl(device, shader_source);
+	auto pipeline = webgpu::compute_pipeline::create(device, {&shader, "main"});
+
+	std::vector<std::thread> threads;
+	std::atomic<bool> failed = false;
+	for (size_t t = 0; t < thread_count; ++t)
+		threads.emplace_back([t, &device, &pipeline, &failed] {
+			struct alive {
+				webgpu::buffer* buffer = nullptr;
+				webgpu::texture* texture = nullptr;
+				webgpu::bind_group* group = nullptr;
+				WGPUBindGroup group_handle = nullptr;
+			};
+			std::array<alive, window> objects;
+
+			for (size_t i = 0; i < iterations; ++i) {
+				auto& slot = objects[i % window];
+				if (slot.buffer) {
+					slot.group->release();
+					slot.texture->release();
+					slot.buffer->release();
+				}
+
+				slot.buffer = &webgpu::confirm_webgpu_type<webgpu::buffer>(device.create_buffer(api::temporary_return, api::usage::Storage, buffer_size(t, i), false, label("Buffer", t, i)));
+				slot.texture = &webgpu::confirm_webgpu_type<webgpu::texture>(device.create_texture(api::temporary_return, {
+					.label = label("Texture", t, i),
+					.format = api::texture_format::RGBAu8_Normalized,
+					.size = texture_size(t, i),
+				}));
+				std::array<api::bind_group::binding, 1> bindings = {api::bind_group::buffer_binding{slot.buffer}};
+				slot.group = &webgpu::confirm_webgpu_type<webgpu::bind_group>(pipeline.create_bind_group(api::temporary_return, device, 0, bindings, label("Bind Group", t, i)));
+				slot.group_handle = slot.group->group;
+
+				// Every object this thread still holds must be the one it created, both in what the wrapper cached and
+				// in what the underlying handle reports
+				for (size_t back = 0; back < std::min(i + 1, window); ++back) {
+					size_t expected = i - back;
+					auto& check = objects[expected % window];
+					if (check.buffer->size() != buffer_size(t, expected) || wgpuBufferGetSize(check.buffer->buffer_) != buffer_size(t, expected))
+						failed = true;
+					auto extent = texture_size(t, expected);
+					auto cached = check.texture->size();
+					if (cached.x != extent.x || cached.y != extent.y || wgpuTextureGetWidth(check.texture->texture_) != extent.x || wgpuTextureGetHeight(check.texture->texture_) != extent.y)
+						failed = true;
+					if (!*check.group || check.group->group != check.group_handle || check.group->index != 0)
+						failed = true;
+				}
+			}
+
+			for (auto& slot : objects)
+				if (slot.buffer) {
+					slot.group->release();
+					slot.texture->release();
+					slot.buffer->release();
+				}
+		});
+	for (auto& thread : threads) thread.join();
+
+	STYLIZER_CHECK(!failed);
+	pipeline.release();
+	shader.release();
+	device.release();
+	return 0;
+}
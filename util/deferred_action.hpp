@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @brief Defines a move-only callable with inline storage and a list of them which avoids heap allocations.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace stylizer {
+
+	/**
+	* @brief Move-only `void()` callable which stores small callables (such as a lambda capturing a GPU object) inline.
+	*
+	* Callables larger than `inline_size` fall back to the heap.
+	*
+	* @note Moving a callable stored inline is assumed not to throw (true of every handle type in this library).
+	*/
+	struct deferred_action {
+		constexpr static size_t inline_size = 6 * sizeof(void*);
+
+		deferred_action() {}
+		template<typename Tfunc>
+		requires(!std::same_as<std::remove_cvref_t<Tfunc>, deferred_action> && std::invocable<std::remove_cvref_t<Tfunc>&>)
+		deferred_action(Tfunc&& func) {
+			using T = std::remove_cvref_t<Tfunc>;
+			if constexpr (stored_inline<T>) new(storage) T(std::forward<Tfunc>(func));
+			else *(T**)storage = new T(std::forward<Tfunc>(func));
+			vtable = &vtable_for<T>;
+		}
+		deferred_action(deferred_action&& o) { *this = std::move(o); }
+		deferred_action& operator=(deferred_action&& o) {
+			if (this == &o) return *this;
+			reset();
+			if (o.vtable) o.vtable->move(storage, o.storage);
+			vtable = std::exchange(o.vtable, nullptr);
+			return *this;
+		}
+		~deferred_action() { reset(); }
+
+		operator bool() const { return vtable; }
+		void operator()() { if (vtable) vtable->invoke(storage); }
+
+		void reset() {
+			if (vtable) std::exchange(vtable, nullptr)->destroy(storage);
+		}
+
+	protected:
+		struct vtable_t {
+			void(*invoke)(std::byte*);
+			void(*move)(std::byte* destination, std::byte* source); // Source is destroyed
+			void(*destroy)(std::byte*);
+		};
+
+		template<typename T>
+		constexpr static bool stored_inline = sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t);
+
+		template<typename T>
+		constexpr static vtable_t vtable_for = stored_inline<T>
+			? vtable_t {
+				[](std::byte* self) { (*std::launder((T*)self))(); },
+				[](std::byte* destination, std::byte* source) {
+					auto& from = *std::launder((T*)source);
+					new(destination) T(std::move(from));
+					from.~T();
+				},
+				[](std::byte* self) { std::launder((T*)self)->~T(); },
+			}
+			: vtable_t {
+				[](std::byte* self) { (**(T**)self)(); },
+				[](std::byte* destination, std::byte* source) { *(T**)destination = *(T**)source; },
+				[](std::byte* self) { delete *(T**)self; },
+			};
+
+		alignas(std::max_align_t) std::byte storage[inline_size];
+		const vtable_t* vtable = nullptr;
+	};
+
+	/**
+	* @brief List of deferred actions which stores its first `N` actions inline.
+	*
+	* Any actions beyond that spill into fixed size blocks which are recycled through a process wide pool, so once a
+	* program has warmed up even large lists no longer allocate. Calling the list runs every action (in the order
+	* they were added) and then empties it.
+	*
+	* @tparam N The number of actions stored inline.
+	*/
+	template<size_t N = 4>
+	struct deferred_action_list {
+		constexpr static size_t block_size = 16;
+
+		deferred_action_list() {}
+		deferred_action_list(deferred_action_list&& o) { *this = std::move(o); }
+		deferred_action_list& operator=(deferred_action_list&& o) {
+			if (this == &o) return *this;
+			clear();
+			for (size_t i = 0; i < std::min(o.count, N); ++i)
+				inline_actions[i] = std::move(o.inline_actions[i]);
+			first_block = std::exchange(o.first_block, nullptr);
+			last_block = std::exchange(o.last_block, nullptr);
+			count = std::exchange(o.count, 0);
+			return *this;
+		}
+		~deferred_action_list() { clear(); }
+
+		template<typename Tfunc>
+		deferred_action_list& push(Tfunc&& func) {
+			next_slot() = deferred_action(std::forward<Tfunc>(func));
+			return *this;
+		}
+		deferred_action_list& push(deferred_action&& action) {
+			next_slot() = std::move(action);
+			return *this;
+		}
+
+		size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		// Runs (and then removes) every action
+		void operator()() {
+			// NOTE: Actions are moved out first so that an action may safely add to (or run) the list
+			auto running = std::move(*this);
+			for (size_t i = 0; i < std::min(running.count, N); ++i)
+				running.inline_actions[i]();
+			for (auto b = running.first_block; b; b = b->next)
+				for (auto& action: b->actions) action(); // Unused slots are empty and do nothing
+		}
+
+		void clear() {
+			for (size_t i = 0; i < std::min(count, N); ++i)
+				inline_actions[i].reset();
+			while (first_block) {
+				auto next = first_block->next;
+				block_pool::release(first_block);
+				first_block = next;
+			}
+			last_block = nullptr;
+			count = 0;
+		}
+
+	protected:
+		struct block {
+			std::array<deferred_action, block_size> actions;
+			block* next = nullptr;
+		};
+
+		// Free list of overflow blocks shared by every list with the same inline capacity
+		struct block_pool {
+			static block* acquire() {
+				{
+					std::scoped_lock lock(mutex());
+					if (auto out = free_list()) {
+						free_list() = std::exchange(out->next, nullptr);
+						return out;
+					}
+				}
+				return new block;
+			}
+			static void release(block* b) {
+				for (auto& action: b->actions) action.reset();
+				std::scoped_lock lock(mutex());
+				b->next = std::exchange(free_list(), b);
+			}
+
+			// NOTE: Leaked so lists destroyed during static destruction never lock a destroyed mutex
+			static std::mutex& mutex() { static auto out = new std::mutex; return *out; }
+			static block*& free_list() { static block* out = nullptr; return out; }
+		};
+
+		deferred_action& next_slot() {
+			size_t index = count++;
+			if (index < N) return inline_actions[index];
+
+			size_t offset = (index - N) % block_size;
+			if (offset == 0) { // The last block is full
+				auto b = block_pool::acquire();
+				if (last_block) last_block->next = b;
+				else first_block = b;
+				last_block = b;
+			}
+			return last_block->actions[offset];
+		}
+
+		std::array<deferred_action, N> inline_actions;
+		block* first_block = nullptr;
+		block* last_block = nullptr;
+		size_t count = 0;
+	};
+
+} // namespace stylizer
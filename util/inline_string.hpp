@@ -0,0 +1,55 @@
+/**
+ * @file
+ * @brief Defines a fixed capacity string which is stored inline (never allocates).
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+namespace stylizer {
+
+	/**
+	* @brief String with a fixed capacity which lives entirely inside the object.
+	*
+	* Anything which doesn't fit is silently truncated, which makes it a good fit for debug information such as labels.
+	* A capacity of zero is valid and stores nothing at all.
+	*
+	* @tparam N The maximum number of characters which can be stored.
+	*/
+	template<size_t N>
+	struct inline_string {
+		std::array<char, N> buffer = {};
+		size_t length = 0;
+
+		inline_string() {}
+		inline_string(std::string_view value) { assign(value); }
+
+		inline_string& assign(std::string_view value) {
+			length = 0;
+			return append(value);
+		}
+
+		inline_string& append(std::string_view value) {
+			size_t count = std::min(value.size(), N - length);
+			std::copy_n(value.data(), count, buffer.data() + length);
+			length += count;
+			return *this;
+		}
+		inline_string& operator+=(std::string_view value) { return append(value); }
+
+		// Returns a copy with the suffix appended
+		inline_string operator+(std::string_view suffix) const {
+			auto out = *this;
+			return out.append(suffix);
+		}
+
+		std::string_view view() const { return {buffer.data(), length}; }
+		operator std::string_view() const { return view(); }
+		size_t size() const { return length; }
+		bool empty() const { return length == 0; }
+		constexpr static size_t capacity() { return N; }
+	};
+
+} // namespace stylizer
@@ -20,6 +20,14 @@
 	type&& move() { return std::move(*this); }                                      \
 	api::type* move_temporary_to_heap(api::type& temporary) override {              \
 		return api::type::move_temporary_to_heap_impl(temporary.as<type>().move()); \
+	}                                                                               \
+	/* Heap copies are recycled through a pool (deleting through a base pointer */  \
+	/*  still finds these since the destructors are virtual) */                     \
+	static void* operator new(size_t size) {                                        \
+		return stylizer::object_pool<type>::allocate(size);                         \
+	}                                                                               \
+	static void operator delete(void* memory, size_t size) {                        \
+		stylizer::object_pool<type>::deallocate(memory, size);                      \
 	}
 
 /**
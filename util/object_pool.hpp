@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @brief Defines per-type free list pools used to recycle the memory of heap allocated objects.
+ */
+
+#pragma once
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace stylizer {
+
+	/**
+	* @brief Process wide free list of `sizeof(T)` sized blocks.
+	*
+	* Freed blocks are kept (up to `max_retained`) and handed back out by the next allocation, so objects which are
+	* repeatedly promoted to the heap (such as a surface texture every frame) stop hitting the global allocator.
+	*
+	* @note Pools can't belong to a device (`move_temporary_to_heap()` isn't given one), so they outlive every device and
+	* 	are shared between them; only memory is pooled, the GPU objects themselves are still released per device.
+	*
+	* @tparam T The type whose memory is being pooled.
+	*/
+	template<typename T>
+	struct object_pool {
+		constexpr static size_t max_retained = 256;
+
+		static void* allocate(size_t size) {
+			if (size != sizeof(T)) return ::operator new(size); // A further derived type
+			{
+				auto& pool = instance();
+				std::scoped_lock lock(pool.mutex);
+				if (!pool.free.empty()) {
+					auto out = pool.free.back();
+					pool.free.pop_back();
+					return out;
+				}
+			}
+			return ::operator new(size);
+		}
+
+		static void deallocate(void* memory, size_t size) {
+			if (!memory) return;
+			if (size == sizeof(T)) {
+				auto& pool = instance();
+				std::scoped_lock lock(pool.mutex);
+				if (pool.free.size() < max_retained) {
+					pool.free.emplace_back(memory);
+					return;
+				}
+			}
+			::operator delete(memory);
+		}
+
+	protected:
+		std::mutex mutex;
+		std::vector<void*> free;
+
+		// NOTE: Intentionally leaked (never destroyed) so objects freed during static destruction, for example a heap
+		// 	promoted texture owned by another static, never touch a pool which has already been destroyed. The retained
+		// 	blocks are reclaimed by the OS at exit.
+		static object_pool& instance() {
+			static auto pool = new object_pool;
+			return *pool;
+		}
+	};
+
+} // namespace stylizer
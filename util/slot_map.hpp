@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @brief Defines generational handles and a densely packed slot map which they index into.
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace stylizer {
+
+	/**
+	* @brief 32-bit reference to a value stored in a `slot_map<T>`.
+	*
+	* The low bits hold the slot index and the high bits the generation of that slot, so a handle to a value which has
+	* since been removed (even if its slot has been reused) is detected instead of silently referencing the new value.
+	* A default constructed handle is never valid.
+	*/
+	template<typename T>
+	struct handle {
+		constexpr static uint32_t index_bits = 20;
+		constexpr static uint32_t generation_bits = 32 - index_bits;
+		constexpr static uint32_t max_index = (1u << index_bits) - 1;
+		constexpr static uint32_t max_generation = (1u << generation_bits) - 1;
+
+		uint32_t value = 0;
+
+		constexpr handle() {}
+		constexpr handle(uint32_t index, uint32_t generation) : value((generation << index_bits) | index) {
+			assert(index <= max_index && generation <= max_generation);
+		}
+
+		constexpr uint32_t index() const { return value & max_index; }
+		constexpr uint32_t generation() const { return value >> index_bits; }
+
+		constexpr operator bool() const { return generation() != 0; } // Generation zero is never handed out
+		constexpr bool operator==(const handle&) const = default;
+	};
+
+	/**
+	* @brief Container handing out generational handles with O(1) insertion, lookup, validation and removal.
+	*
+	* Values are kept densely packed (removal swaps the last value into the hole) so iterating over every value stays
+	* cache friendly. The bookkeeping is kept in separate arrays (structure of arrays) so validating a handle only
+	* touches the generations.
+	*
+	* @note Pointers returned by `get()` are invalidated by the next insertion or removal, since values are relocated
+	* 	(by move) when the storage grows or a hole is filled.
+	* @note Not thread safe, access must be externally synchronized.
+	*/
+	template<typename T>
+	struct slot_map {
+		// Otherwise std::vector copies (instead of moves) values when it grows, which breaks values that point at themselves
+		static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "Slot map values must have noexcept moves");
+		using handle_t = handle<T>;
+
+		std::vector<T> values = {}; // Dense
+		std::vector<uint32_t> dense_to_slot = {}; // Which slot each value belongs to
+		std::vector<uint32_t> slot_to_dense = {}; // Where each slot's value lives in values
+		std::vector<uint32_t> generations = {}; // Current generation of each slot
+		std::vector<uint32_t> free_slots = {};
+
+		handle_t insert(T&& value) {
+			uint32_t slot;
+			if (!free_slots.empty()) {
+				slot = free_slots.back();
+				free_slots.pop_back();
+			} else {
+				slot = slot_to_dense.size();
+				assert(slot <= handle_t::max_index);
+				slot_to_dense.emplace_back(0);
+				generations.emplace_back(1);
+			}
+
+			slot_to_dense[slot] = values.size();
+			dense_to_slot.emplace_back(slot);
+			values.emplace_back(std::move(value));
+			return {slot, generations[slot]};
+		}
+
+		bool contains(handle_t handle) const {
+			return handle && handle.index() < generations.size() && generations[handle.index()] == handle.generation();
+		}
+
+		T* get(handle_t handle) {
+			if (!contains(handle)) return nullptr;
+			return &values[slot_to_dense[handle.index()]];
+		}
+		const T* get(handle_t handle) const { return const_cast<slot_map*>(this)->get(handle); }
+
+		// Removes the value (returning it) and invalidates every handle to it
+		std::optional<T> erase(handle_t handle) {
+			if (!contains(handle)) return {};
+			auto slot = handle.index();
+			auto dense = slot_to_dense[slot];
+
+			std::optional<T> out = std::move(values[dense]);
+			if (dense != values.size() - 1) { // Fill the hole with the last value
+				values[dense] = std::move(values.back());
+				dense_to_slot[dense] = dense_to_slot.back();
+				slot_to_dense[dense_to_slot[dense]] = dense;
+			}
+			values.pop_back();
+			dense_to_slot.pop_back();
+
+			// Bump the generation (skipping zero) so existing handles no longer validate
+			generations[slot] = generations[slot] == handle_t::max_generation ? 1 : generations[slot] + 1;
+			free_slots.emplace_back(slot);
+			return out;
+		}
+
+		size_t size() const { return values.size(); }
+		bool empty() const { return values.empty(); }
+
+		auto begin() { return values.begin(); }
+		auto end() { return values.end(); }
+		auto begin() const { return values.begin(); }
+		auto end() const { return values.end(); }
+	};
+
+} // namespace stylizer
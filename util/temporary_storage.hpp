@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @brief Defines the storage backing the objects returned by `temporary_return_t` overloads.
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/**
+* @brief Number of temporaries of each type (per thread) which may be alive at the same time.
+*/
+#ifndef STYLIZER_API_TEMPORARY_RING_SIZE
+	#define STYLIZER_API_TEMPORARY_RING_SIZE 16
+#endif
+
+namespace stylizer::api {
+
+	/**
+	* @brief Moves a value into the calling thread's ring of temporaries and returns a reference to it.
+	*
+	* Every thread owns its own ring for every type, so temporaries never race with other threads and up to
+	* `STYLIZER_API_TEMPORARY_RING_SIZE` temporaries of the same type may be alive at once.
+	*
+	* @note A temporary only lives until `STYLIZER_API_TEMPORARY_RING_SIZE` more temporaries of the same type have been
+	* 	created on the same thread, at which point its slot is reused. Temporaries must be released, or moved somewhere
+	* 	more permanent with `move_temporary_to_heap()`, before then. The slot is overwritten without being released,
+	* 	and any reference still pointing at it silently refers to the newer temporary.
+	* @note A live slot can't be detected reliably (handles released through a copy, e.g. `release_on_submit`, leave
+	* 	the slot itself non-null) so this limit is not checked.
+	*
+	* @tparam T The type of the temporary.
+	* @param value The value to store.
+	* @return A reference to the stored temporary.
+	*/
+	template<typename T>
+	T& temporary_storage(T&& value) {
+		thread_local std::array<T, STYLIZER_API_TEMPORARY_RING_SIZE> ring;
+		thread_local size_t next = 0;
+		auto& slot = ring[next];
+		next = (next + 1) % ring.size();
+		return slot = std::move(value);
+	}
+
+} // namespace stylizer::api